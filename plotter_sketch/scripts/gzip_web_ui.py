@@ -0,0 +1,63 @@
+"""
+Compress web/index.html into src/web_ui_gz.h (gzip bytes in PROGMEM plus
+an ETag derived from them).
+
+Runs before every PlatformIO build (extra_scripts in platformio.ini) and
+can also be run by hand:
+    python3 scripts/gzip_web_ui.py
+The header is only rewritten when the page changes, so unchanged builds
+stay incremental.
+"""
+
+import gzip
+import hashlib
+import os
+
+try:
+    Import("env")  # noqa: F821 - provided by PlatformIO
+    PROJECT_DIR = env.subst("$PROJECT_DIR")  # noqa: F821
+except NameError:
+    PROJECT_DIR = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+
+SOURCE = os.path.join(PROJECT_DIR, "web", "index.html")
+OUTPUT = os.path.join(PROJECT_DIR, "src", "web_ui_gz.h")
+
+
+def build_header(html):
+    # mtime=0 keeps the output (and so the ETag) identical for identical input
+    data = gzip.compress(html, compresslevel=9, mtime=0)
+    etag = hashlib.sha1(data).hexdigest()[:16]
+
+    lines = [
+        "// Generated by scripts/gzip_web_ui.py from web/index.html - do not edit",
+        "#ifndef WEB_UI_GZ_H",
+        "#define WEB_UI_GZ_H",
+        "",
+        "#include <Arduino.h>",
+        "",
+        f'#define WEB_UI_ETAG "\\"{etag}\\""',
+        f"#define WEB_UI_GZ_LEN {len(data)}",
+        "",
+        "const uint8_t WEB_UI_GZ[] PROGMEM = {",
+    ]
+    for i in range(0, len(data), 16):
+        lines.append("  " + ", ".join(f"0x{b:02x}" for b in data[i:i + 16]) + ",")
+    lines += ["};", "", "#endif // WEB_UI_GZ_H", ""]
+    return "\n".join(lines), len(html), len(data)
+
+
+def main():
+    with open(SOURCE, "rb") as f:
+        header, size_in, size_out = build_header(f.read())
+
+    if os.path.exists(OUTPUT):
+        with open(OUTPUT) as f:
+            if f.read() == header:
+                return
+
+    with open(OUTPUT, "w") as f:
+        f.write(header)
+    print(f"Web UI: {size_in} -> {size_out} bytes gzipped ({OUTPUT})")
+
+
+main()
@@ -0,0 +1,229 @@
+#ifndef BINARY_JOB_H
+#define BINARY_JOB_H
+
+#include <Arduino.h>
+#include "motor_control.h"
+#include "motion.h"
+#include "path_simplifier.h"
+
+/*
+ * Binary job format, version 2 (little endian)
+ *
+ * Header, 8 bytes:
+ *   0..2  "PBJ"
+ *   3     Version (2; version 1 files, without FEED, are still read)
+ *   4..5  Coordinate units per mm (uint16, e.g. 100 = 0.01 mm)
+ *   6..7  Reserved (0)
+ *
+ * Records, one opcode byte each:
+ *   0x00  END         Optional, nothing after it is read
+ *   0x01  PEN_UP
+ *   0x02  PEN_DOWN
+ *   0x03  HOME        Pen up, back to 0,0 (G28)
+ *   0x04  MOVE dx dy  Zigzag varint deltas in units. Draws if the pen is
+ *                     down, travels (pen up) otherwise.
+ *   0x05  FEED f      Zigzag varint drawing feed in units per minute, like
+ *                     a modal F word; 0 goes back to the axis limit
+ *
+ * Coordinates start at 0,0 and are absolute machine positions once the
+ * deltas are summed, like G90 G-code.
+ */
+#define BINARY_JOB_VERSION 2
+#define BINARY_JOB_MIN_VERSION 1
+#define BINARY_HEADER_SIZE 8
+
+enum BinaryOp {
+  BIN_END = 0x00,
+  BIN_PEN_UP = 0x01,
+  BIN_PEN_DOWN = 0x02,
+  BIN_HOME = 0x03,
+  BIN_MOVE = 0x04,
+  BIN_FEED = 0x05           // Version 2
+};
+
+/**
+ * Result of executing one record
+ */
+enum BinaryResult {
+  BINARY_DONE,      // END record or end of file
+  BINARY_OK,
+  BINARY_ERROR      // Unknown opcode or truncated record
+};
+
+/**
+ * Check a header
+ * @param header BINARY_HEADER_SIZE bytes
+ * @param unitsPerMm Receives the coordinate scale
+ * @return false if this is not a binary job of a version we read
+ */
+bool binaryParseHeader(const uint8_t* header, uint16_t* unitsPerMm) {
+  if (header[0] != 'P' || header[1] != 'B' || header[2] != 'J') return false;
+  if (header[3] < BINARY_JOB_MIN_VERSION || header[3] > BINARY_JOB_VERSION) return false;
+
+  *unitsPerMm = header[4] | (header[5] << 8);
+  return *unitsPerMm > 0;
+}
+
+/**
+ * Upload-side check of a binary job as it streams in: validates the header
+ * and opcodes and counts records, without decoding coordinates
+ */
+struct BinaryScanner {
+  uint8_t header[BINARY_HEADER_SIZE];
+  size_t headerLength;
+  uint8_t varintsLeft;      // Operand varints still to skip
+  bool ended;               // END seen
+  bool invalid;
+  int records;
+};
+
+void binaryScanBegin(BinaryScanner* scan) {
+  scan->headerLength = 0;
+  scan->varintsLeft = 0;
+  scan->ended = false;
+  scan->invalid = false;
+  scan->records = 0;
+}
+
+void binaryScanFeed(BinaryScanner* scan, const uint8_t* data, size_t length) {
+  for (size_t i = 0; i < length && !scan->invalid && !scan->ended; i++) {
+    uint8_t b = data[i];
+
+    if (scan->headerLength < BINARY_HEADER_SIZE) {
+      scan->header[scan->headerLength++] = b;
+      uint16_t unitsPerMm;
+      if (scan->headerLength == BINARY_HEADER_SIZE && !binaryParseHeader(scan->header, &unitsPerMm)) {
+        scan->invalid = true;
+      }
+    } else if (scan->varintsLeft > 0) {
+      // Last byte of a varint has the top bit clear
+      if (!(b & 0x80)) scan->varintsLeft--;
+    } else if (b == BIN_END) {
+      scan->ended = true;
+    } else if (b == BIN_PEN_UP || b == BIN_PEN_DOWN || b == BIN_HOME) {
+      scan->records++;
+    } else if (b == BIN_MOVE) {
+      scan->varintsLeft = 2;
+      scan->records++;
+    } else if (b == BIN_FEED && scan->header[3] >= 2) {
+      scan->varintsLeft = 1;
+      scan->records++;
+    } else {
+      scan->invalid = true;
+    }
+  }
+}
+
+/**
+ * True if the whole upload was a well-formed binary job
+ */
+bool binaryScanValid(const BinaryScanner* scan) {
+  return !scan->invalid && scan->headerLength == BINARY_HEADER_SIZE && scan->varintsLeft == 0;
+}
+
+/**
+ * Execution state of a binary job (motion task)
+ */
+struct BinaryDecoder {
+  float mmPerUnit;
+  int32_t x;                // Position in units
+  int32_t y;
+  bool penDown;
+};
+
+void binaryDecodeBegin(BinaryDecoder* dec, uint16_t unitsPerMm) {
+  dec->mmPerUnit = 1.0f / unitsPerMm;
+  dec->x = 0;
+  dec->y = 0;
+  dec->penDown = false;
+}
+
+/**
+ * Read a zigzag varint
+ * @return false if the input ended inside it or it is too long
+ */
+bool binaryReadVarint(int (*readByte)(), int32_t* value) {
+  uint32_t raw = 0;
+  for (int shift = 0; shift < 35; shift += 7) {
+    int b = readByte();
+    if (b < 0) return false;
+    raw |= (uint32_t)(b & 0x7F) << shift;
+    if (!(b & 0x80)) {
+      *value = (int32_t)(raw >> 1) ^ -(int32_t)(raw & 1);
+      return true;
+    }
+  }
+  return false;
+}
+
+/**
+ * Read and execute one record. Moves go through the same pen state
+ * machine and path simplifier as G0/G1.
+ * @param readByte Next byte of the job, or -1 at end of file
+ */
+BinaryResult binaryExecuteNext(BinaryDecoder* dec, int (*readByte)()) {
+  int op = readByte();
+  if (op < 0 || op == BIN_END) return BINARY_DONE;
+
+  switch (op) {
+    case BIN_PEN_UP:
+      simplifyFlush();
+      penUp();
+      dec->penDown = false;
+      return BINARY_OK;
+
+    case BIN_PEN_DOWN:
+      simplifyFlush();
+      penDown();
+      dec->penDown = true;
+      return BINARY_OK;
+
+    case BIN_HOME:
+      simplifyFlush();
+      homeMotors();
+      dec->x = 0;
+      dec->y = 0;
+      dec->penDown = false;
+      return BINARY_OK;
+
+    case BIN_MOVE: {
+      int32_t dx, dy;
+      if (!binaryReadVarint(readByte, &dx) || !binaryReadVarint(readByte, &dy)) {
+        return BINARY_ERROR;
+      }
+      dec->x += dx;
+      dec->y += dy;
+      float x = dec->x * dec->mmPerUnit;
+      float y = dec->y * dec->mmPerUnit;
+
+      if (dec->penDown) {
+        if (penState != PEN_LOWERED) {
+          simplifyFlush();
+          penDown();
+        }
+        simplifyAddPoint(x, y);
+      } else {
+        simplifyFlush();
+        penUp();
+        moveTo(x, y, PEN_UP_Z);
+      }
+      return BINARY_OK;
+    }
+
+    case BIN_FEED: {
+      int32_t feed;
+      if (!binaryReadVarint(readByte, &feed) || feed < 0) {
+        return BINARY_ERROR;
+      }
+      // Moves collected so far keep the feed they were drawn at
+      simplifyFlush();
+      drawFeedMmMin = feed * dec->mmPerUnit;
+      return BINARY_OK;
+    }
+
+    default:
+      return BINARY_ERROR;
+  }
+}
+
+#endif // BINARY_JOB_H
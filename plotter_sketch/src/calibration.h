@@ -0,0 +1,277 @@
+#ifndef CALIBRATION_H
+#define CALIBRATION_H
+
+#include <Arduino.h>
+#include <Preferences.h>
+#include "motor_control.h"
+#include "planner.h"
+#include "motion.h"
+
+/*
+ * Step-rate calibration. The motors are open loop, so the firmware cannot
+ * tell when one stalls; instead it plots a witness pattern and the
+ * operator reads it. Each row tests one step period, fastest last:
+ *
+ *   1. Draw a short tick across the axis at the row's start (safe rate)
+ *   2. Sweep the axis back and forth with the pen up at the test rate
+ *   3. Draw a second tick in line with the first (safe rate)
+ *
+ * A motor that lost steps during the sweep puts the second tick beside
+ * the first. The operator reports the last row whose ticks line up; that
+ * period, slowed by CALIBRATION_MARGIN, is stored in NVS. For Z, the pen
+ * is lifted and dropped at the test rate and a line drawn after it: a
+ * faint or missing line means Z lost steps.
+ *
+ * "start" rows test the period the axis can start at from standstill (no
+ * acceleration); "cruise" rows accelerate from the stored start period.
+ * Sweeps run in half steps, the weaker drive mode, so the limits found
+ * also hold for full-step travel.
+ */
+
+#define CALIBRATION_VERSION 1
+#define CALIBRATION_ROWS 11
+#define CALIBRATION_SAFE_DELAY_US 2500  // Reference ticks are drawn at this period
+#define CALIBRATION_MARGIN 0.8f         // Stored rate is this share of the last good one
+#define CALIBRATION_ORIGIN_MM 10.0f     // Pattern corner, from home
+#define CALIBRATION_SWEEP_MM 40.0f
+#define CALIBRATION_SWEEPS 5
+#define CALIBRATION_ROW_PITCH_MM 6.0f
+#define CALIBRATION_TICK_MM 2.0f
+#define CALIBRATION_TICK_GAP_MM 0.5f    // Between the two ticks of a row
+#define CALIBRATION_Z_LINE_MM 20.0f
+
+// Candidate step periods (microseconds), one per row
+const int calibrationDelaysUs[CALIBRATION_ROWS] = {2000, 1700, 1400, 1200, 1000, 850, 700, 600, 500, 420, 350};
+
+enum CalibrationMode {
+  CALIBRATE_START,
+  CALIBRATE_CRUISE
+};
+
+/**
+ * Stored limits, as one NVS blob
+ */
+struct CalibrationData {
+  uint32_t version;
+  int32_t startDelayUs[3];
+  int32_t cruiseDelayUs[3];
+};
+
+// Set by the network task, run by the motion task once nothing else is
+volatile bool calibrationPending = false;
+volatile bool calibrationActive = false;
+int calibrationAxis = AXIS_X;
+CalibrationMode calibrationMode = CALIBRATE_START;
+
+const char* calibrationModeName(CalibrationMode mode) {
+  return mode == CALIBRATE_CRUISE ? "cruise" : "start";
+}
+
+/**
+ * Apply the limits stored in NVS, if any
+ * @return true if stored limits were found
+ */
+bool calibrationLoad() {
+  Preferences prefs;
+  if (!prefs.begin("plotter", true)) return false;
+
+  CalibrationData data;
+  bool ok = prefs.getBytesLength("calibration") == sizeof(data) &&
+            prefs.getBytes("calibration", &data, sizeof(data)) == sizeof(data) &&
+            data.version == CALIBRATION_VERSION;
+  prefs.end();
+  if (!ok) return false;
+
+  for (int i = 0; i < 3; i++) {
+    axisStartDelayUs[i] = data.startDelayUs[i];
+    axisCruiseDelayUs[i] = data.cruiseDelayUs[i];
+  }
+  return true;
+}
+
+/**
+ * Store the limits now in use
+ */
+bool calibrationSave() {
+  Preferences prefs;
+  if (!prefs.begin("plotter", false)) return false;
+
+  CalibrationData data;
+  data.version = CALIBRATION_VERSION;
+  for (int i = 0; i < 3; i++) {
+    data.startDelayUs[i] = axisStartDelayUs[i];
+    data.cruiseDelayUs[i] = axisCruiseDelayUs[i];
+  }
+  bool ok = prefs.putBytes("calibration", &data, sizeof(data)) == sizeof(data);
+  prefs.end();
+  return ok;
+}
+
+/**
+ * Forget the stored limits and go back to the defaults
+ */
+void calibrationReset() {
+  Preferences prefs;
+  if (prefs.begin("plotter", false)) {
+    prefs.remove("calibration");
+    prefs.end();
+  }
+
+  for (int i = 0; i < 3; i++) {
+    axisStartDelayUs[i] = DEFAULT_START_DELAY_US;
+    axisCruiseDelayUs[i] = DEFAULT_CRUISE_DELAY_US;
+  }
+}
+
+/**
+ * Ask the motion task to plot a pattern
+ * @return false if one is already pending or running
+ */
+bool calibrationRequest(int axis, CalibrationMode mode) {
+  if (calibrationPending || calibrationActive) return false;
+  calibrationAxis = axis;
+  calibrationMode = mode;
+  calibrationPending = true;
+  return true;
+}
+
+/**
+ * Take the operator's reading: row is the last row whose marks line up.
+ * The row's period, slowed by the margin, becomes the axis limit; the
+ * cruise period is kept no slower than the start period.
+ * @return false if row is out of range
+ */
+bool calibrationApply(int axis, CalibrationMode mode, int row) {
+  if (axis < 0 || axis > 2 || row < 0 || row >= CALIBRATION_ROWS) return false;
+
+  int delayUs = (int)(calibrationDelaysUs[row] / CALIBRATION_MARGIN);
+  if (mode == CALIBRATE_START) {
+    axisStartDelayUs[axis] = delayUs;
+    axisCruiseDelayUs[axis] = min(axisCruiseDelayUs[axis], delayUs);
+  } else {
+    axisCruiseDelayUs[axis] = min(delayUs, axisStartDelayUs[axis]);
+  }
+  return calibrationSave();
+}
+
+/**
+ * Move in pattern coordinates: along the axis under test, and across it
+ */
+void calibrationMoveTo(int axis, float along, float across, float z) {
+  if (axis == AXIS_Y) {
+    moveTo(CALIBRATION_ORIGIN_MM + across, CALIBRATION_ORIGIN_MM + along, z);
+  } else {
+    moveTo(CALIBRATION_ORIGIN_MM + along, CALIBRATION_ORIGIN_MM + across, z);
+  }
+}
+
+/**
+ * Draw a tick across the axis at along = 0
+ */
+void calibrationTick(int axis, float from, float to) {
+  calibrationMoveTo(axis, 0, from, PEN_UP_Z);
+  calibrationMoveTo(axis, 0, from, PEN_DOWN_Z);
+  calibrationMoveTo(axis, 0, to, PEN_DOWN_Z);
+  calibrationMoveTo(axis, 0, to, PEN_UP_Z);
+}
+
+/**
+ * Use delayUs for the axis under test (and the other axes, which stand
+ * still during the test moves)
+ */
+void calibrationSetDelay(int axis, CalibrationMode mode, int delayUs, const CalibrationData* saved) {
+  plannerSynchronize();
+  for (int i = 0; i < 3; i++) {
+    axisStartDelayUs[i] = CALIBRATION_SAFE_DELAY_US;
+    axisCruiseDelayUs[i] = CALIBRATION_SAFE_DELAY_US;
+  }
+  if (mode == CALIBRATE_START) {
+    axisStartDelayUs[axis] = delayUs;
+    axisCruiseDelayUs[axis] = delayUs;
+  } else {
+    axisStartDelayUs[axis] = saved->startDelayUs[axis];
+    axisCruiseDelayUs[axis] = delayUs;
+  }
+}
+
+/**
+ * Plot one row of the pattern
+ */
+void calibrationRow(int axis, CalibrationMode mode, int row, const CalibrationData* saved) {
+  float across = row * CALIBRATION_ROW_PITCH_MM;
+  int delayUs = calibrationDelaysUs[row];
+
+  if (axis == AXIS_Z) {
+    calibrationMoveTo(axis, 0, across, PEN_UP_Z);
+    calibrationSetDelay(axis, mode, delayUs, saved);
+    for (int n = 0; n < CALIBRATION_SWEEPS && !motionAbortRequested; n++) {
+      calibrationMoveTo(axis, 0, across, PEN_DOWN_Z);
+      calibrationMoveTo(axis, 0, across, PEN_UP_Z);
+    }
+    calibrationSetDelay(axis, mode, CALIBRATION_SAFE_DELAY_US, saved);
+    calibrationMoveTo(axis, 0, across, PEN_DOWN_Z);
+    calibrationMoveTo(axis, CALIBRATION_Z_LINE_MM, across, PEN_DOWN_Z);
+    calibrationMoveTo(axis, CALIBRATION_Z_LINE_MM, across, PEN_UP_Z);
+    return;
+  }
+
+  calibrationTick(axis, across, across + CALIBRATION_TICK_MM);
+
+  calibrationSetDelay(axis, mode, delayUs, saved);
+  for (int n = 0; n < CALIBRATION_SWEEPS && !motionAbortRequested; n++) {
+    calibrationMoveTo(axis, CALIBRATION_SWEEP_MM, across + CALIBRATION_TICK_MM, PEN_UP_Z);
+    calibrationMoveTo(axis, 0, across + CALIBRATION_TICK_MM, PEN_UP_Z);
+  }
+  calibrationSetDelay(axis, mode, CALIBRATION_SAFE_DELAY_US, saved);
+
+  float second = across + CALIBRATION_TICK_MM + CALIBRATION_TICK_GAP_MM;
+  calibrationTick(axis, second, second + CALIBRATION_TICK_MM);
+}
+
+/**
+ * Plot the pending pattern. Runs in the motion task and blocks it until
+ * the pattern is done or a stop aborts it; the limits in use before are
+ * always restored.
+ */
+void calibrationRun() {
+  int axis = calibrationAxis;
+  CalibrationMode mode = calibrationMode;
+  calibrationActive = true;
+  calibrationPending = false;
+
+  Serial.print("Calibrating ");
+  Serial.print("XYZ"[axis]);
+  Serial.print(" ");
+  Serial.println(calibrationModeName(mode));
+
+  CalibrationData saved;
+  for (int i = 0; i < 3; i++) {
+    saved.startDelayUs[i] = axisStartDelayUs[i];
+    saved.cruiseDelayUs[i] = axisCruiseDelayUs[i];
+  }
+  calibrationSetDelay(axis, mode, CALIBRATION_SAFE_DELAY_US, &saved);
+  bool savedFullStepTravel = fullStepTravel;
+  fullStepTravel = false;
+
+  for (int row = 0; row < CALIBRATION_ROWS && !motionAbortRequested; row++) {
+    calibrationRow(axis, mode, row, &saved);
+  }
+  if (!motionAbortRequested) {
+    penUp();
+    plannerSynchronize();
+  }
+  if (motionAbortRequested) {
+    motionStopAndFlush();
+    motionAbortRequested = false;
+    Serial.println("  -> Calibration aborted");
+  }
+
+  for (int i = 0; i < 3; i++) {
+    axisStartDelayUs[i] = saved.startDelayUs[i];
+    axisCruiseDelayUs[i] = saved.cruiseDelayUs[i];
+  }
+  fullStepTravel = savedFullStepTravel;
+  calibrationActive = false;
+}
+
+#endif // CALIBRATION_H
@@ -0,0 +1,102 @@
+#ifndef DRY_RUN_H
+#define DRY_RUN_H
+
+#include <Arduino.h>
+
+/*
+ * Dry run: a job goes through the real parser, planner and segment
+ * preparation, but the step timer is never started. Whenever the motion
+ * code would wait for the motors, it retires one prepared segment instead
+ * and advances a virtual clock by that segment's duration. Pen settle
+ * times are added to the clock instead of slept.
+ */
+
+#define DRY_RUN_YIELD_MS 50             // Let other tasks on the core run this often
+
+/**
+ * What a dry run measured
+ */
+struct DryRunReport {
+  uint32_t steps[3];        // Step events per axis (X, Y, Z)
+  uint32_t penLifts;
+  uint32_t penDrops;
+  float drawMm;             // XY distance with the pen down
+  float travelMm;           // XY distance with the pen up
+  float minX, minY;         // Bounding box of the pen-down moves
+  float maxX, maxY;
+  uint64_t durationUs;      // Predicted plot time
+};
+
+// Set while the motion task runs a dry-run job
+volatile bool dryRunActive = false;
+
+DryRunReport dryRunReport;
+uint32_t dryRunLastYield = 0;
+
+/**
+ * Clear the report before a dry run
+ */
+void dryRunBegin() {
+  memset(&dryRunReport, 0, sizeof(dryRunReport));
+  dryRunReport.minX = 1e30f;
+  dryRunReport.minY = 1e30f;
+  dryRunReport.maxX = -1e30f;
+  dryRunReport.maxY = -1e30f;
+  dryRunLastYield = millis();
+}
+
+/**
+ * True if the report saw any pen-down move (its bounding box is valid)
+ */
+bool dryRunHasBounds(const DryRunReport* report) {
+  return report->maxX >= report->minX;
+}
+
+/**
+ * Count one XY move
+ * @param drawing Pen down for the whole move
+ */
+void dryRunRecordMove(float fromX, float fromY, float toX, float toY, bool drawing) {
+  float distance = sqrtf((toX - fromX) * (toX - fromX) + (toY - fromY) * (toY - fromY));
+  if (!drawing) {
+    dryRunReport.travelMm += distance;
+    return;
+  }
+
+  dryRunReport.drawMm += distance;
+  dryRunReport.minX = min(dryRunReport.minX, min(fromX, toX));
+  dryRunReport.minY = min(dryRunReport.minY, min(fromY, toY));
+  dryRunReport.maxX = max(dryRunReport.maxX, max(fromX, toX));
+  dryRunReport.maxY = max(dryRunReport.maxY, max(fromY, toY));
+}
+
+/**
+ * Count a pen lift or drop
+ */
+void dryRunRecordPen(bool lowered) {
+  if (lowered) {
+    dryRunReport.penDrops++;
+  } else {
+    dryRunReport.penLifts++;
+  }
+}
+
+/**
+ * Advance the virtual clock
+ */
+void dryRunAddTime(uint32_t us) {
+  dryRunReport.durationUs += us;
+}
+
+/**
+ * Sleep a tick now and then: a dry run never waits on the motors, so it
+ * would otherwise keep the core to itself
+ */
+void dryRunYield() {
+  if (millis() - dryRunLastYield > DRY_RUN_YIELD_MS) {
+    vTaskDelay(1);
+    dryRunLastYield = millis();
+  }
+}
+
+#endif // DRY_RUN_H
@@ -3,6 +3,11 @@
 
 #include <Arduino.h>
 #include "motor_control.h"
+#include "motion.h"
+#include "path_simplifier.h"
+#include "dry_run.h"
+#include "metrics.h"
+#include "gcode_tokenizer.h"
 
 // Movement mode
 bool absoluteMode = true;  // true = G90 (absolute), false = G91 (relative)
@@ -12,159 +17,222 @@ float lastX = 0.0;
 float lastY = 0.0;
 float lastZ = 0.0;
 
+// Echo executed lines to Serial (off while a serial sender streams, which
+// expects nothing but its replies)
+bool gcodeEcho = true;
+
+/**
+ * Echo what a line did to Serial. Silent during dry runs, where printing
+ * would take longer than simulating the moves, and when echo is off.
+ * @param line Printed after message, if given
+ */
+void gcodeLog(const char* message, const char* line = NULL) {
+  if (dryRunActive || !gcodeEcho) return;
+  if (line != NULL) {
+    Serial.print(message);
+    Serial.println(line);
+  } else {
+    Serial.println(message);
+  }
+}
+
+/**
+ * Work out the center of a G2/G3 arc from the current position, as an
+ * offset from it. I and J are always relative to the start; with R the
+ * center is on the side that gives the shorter arc, or the longer one
+ * when R is negative.
+ * @param x,y Arc end
+ * @return false if the arc is malformed (no center, end off the circle)
+ */
+bool arcCenterOffset(const GCodeBlock* block, float x, float y, bool clockwise, float* i, float* j) {
+  if (hasWord(block, 'Z')) return false;  // No helical moves on a pen plotter
+
+  float dx = x - currentX;
+  float dy = y - currentY;
+
+  if (hasWord(block, 'R')) {
+    float r = wordValue(block, 'R');
+    float distance = sqrtf(dx * dx + dy * dy);
+    if (distance == 0.0f) return false;  // R cannot describe a full circle
+
+    // Distance from the chord midpoint to the center, over half the chord
+    float h = 4.0f * r * r - dx * dx - dy * dy;
+    if (h < 0.0f) return false;          // End farther than the diameter
+    h = -sqrtf(h) / distance;
+    if (!clockwise) h = -h;
+    if (r < 0.0f) h = -h;
+
+    *i = 0.5f * (dx - dy * h);
+    *j = 0.5f * (dy + dx * h);
+    return true;
+  }
+
+  if (!hasWord(block, 'I') && !hasWord(block, 'J')) return false;
+  *i = hasWord(block, 'I') ? wordValue(block, 'I') : 0.0f;
+  *j = hasWord(block, 'J') ? wordValue(block, 'J') : 0.0f;
+
+  // The end must lie on the circle through the start
+  float radius = sqrtf(*i * *i + *j * *j);
+  float ex = dx - *i;
+  float ey = dy - *j;
+  float error = fabsf(sqrtf(ex * ex + ey * ey) - radius);
+  return radius > 0.0f && (error <= 0.5f || error <= 0.001f * radius);
+}
+
 /**
  * Parse a single G-code line and execute it
- * @param line G-code command string
+ * @param line Null-terminated G-code line
  * @return true if command executed successfully
  */
-bool executeGCode(String line) {
-  line.trim();
-  line.toUpperCase();
+bool executeGCode(const char* line) {
+  GCodeBlock block;
+
+  METRICS_START(parseStart);
+  bool parsed = parseGCodeLine(line, &block);
+  METRICS_STOP(gcodeParseTimer, parseStart);
+  if (!parsed) {
+    gcodeLog("  -> Syntax error: ", line);
+    return false;
+  }
 
   // Skip empty lines and comments
-  if (line.length() == 0 || line.startsWith(";") || line.startsWith("(")) {
+  if (block.present == 0) {
     return true;
   }
 
-  Serial.print("Executing: ");
-  Serial.println(line);
+  gcodeLog("Executing: ", line);
 
-  // Extract command (G0, G1, M3, etc.)
-  String command = "";
-  int spaceIndex = line.indexOf(' ');
-  if (spaceIndex > 0) {
-    command = line.substring(0, spaceIndex);
-  } else {
-    command = line;
-  }
+  // Command number (G0, G1, M3, etc.)
+  bool isG = hasWord(&block, 'G');
+  bool isM = !isG && hasWord(&block, 'M');
+  int code = isG ? (int)wordValue(&block, 'G') : (isM ? (int)wordValue(&block, 'M') : -1);
 
   // Parse parameters
-  float x = currentX;
-  float y = currentY;
-  float z = currentZ;
-  bool hasX = false, hasY = false, hasZ = false;
-
-  // Extract X parameter
-  int xIndex = line.indexOf('X');
-  if (xIndex >= 0) {
-    float xValue = line.substring(xIndex + 1).toFloat();
-    x = absoluteMode ? xValue : currentX + xValue;
-    hasX = true;
+  bool hasX = hasWord(&block, 'X');
+  bool hasY = hasWord(&block, 'Y');
+  bool hasZ = hasWord(&block, 'Z');
+
+  // Feed rate (modal, mm/min) for this and later drawing moves
+  bool hasF = hasWord(&block, 'F');
+  float feed = hasF ? wordValue(&block, 'F') : drawFeedMmMin;
+  if (hasF && feed <= 0.0f) {
+    gcodeLog("  -> Invalid feed rate: ", line);
+    return false;
   }
 
-  // Extract Y parameter
-  int yIndex = line.indexOf('Y');
-  if (yIndex >= 0) {
-    float yValue = line.substring(yIndex + 1).toFloat();
-    y = absoluteMode ? yValue : currentY + yValue;
-    hasY = true;
+  // Pen-down XY moves at one feed are collected for simplification;
+  // anything else queues the collected run first
+  bool simplifiable = isG && code == 1 && !hasZ && penState == PEN_LOWERED && feed == drawFeedMmMin;
+  if (!simplifiable) {
+    simplifyFlush();
   }
+  drawFeedMmMin = feed;
+  if (!isG && !isM && hasF) {
+    return true;  // F on its own line
+  }
+
+  float x = simplifyCommandedX();
+  float y = simplifyCommandedY();
+  float z = currentZ;
 
-  // Extract Z parameter
-  int zIndex = line.indexOf('Z');
-  if (zIndex >= 0) {
-    float zValue = line.substring(zIndex + 1).toFloat();
-    z = absoluteMode ? zValue : currentZ + zValue;
-    hasZ = true;
+  if (hasX) {
+    x = absoluteMode ? wordValue(&block, 'X') : x + wordValue(&block, 'X');
+  }
+  if (hasY) {
+    y = absoluteMode ? wordValue(&block, 'Y') : y + wordValue(&block, 'Y');
+  }
+  if (hasZ) {
+    z = absoluteMode ? wordValue(&block, 'Z') : currentZ + wordValue(&block, 'Z');
   }
 
   // Execute command
-  if (command == "G0" || command == "G00") {
+  if (isG && code == 0) {
     // Rapid positioning (pen up)
-    Serial.println("  -> Rapid move (pen up)");
+    gcodeLog("  -> Rapid move (pen up)");
     penUp();
     if (hasX || hasY) {
-      moveTo(x, y, 5.0);  // Keep pen up
+      moveTo(x, y, PEN_UP_Z);  // Keep pen up
     }
     return true;
   }
-  else if (command == "G1" || command == "G01") {
+  else if (isG && code == 1) {
     // Linear move (pen down)
-    Serial.println("  -> Linear move (pen down)");
+    gcodeLog("  -> Linear move (pen down)");
+    if (simplifiable) {
+      if (hasX || hasY) simplifyAddPoint(x, y);
+      return true;
+    }
     penDown();
     if (hasX || hasY || hasZ) {
       moveTo(x, y, z);
     }
     return true;
   }
-  else if (command == "G28") {
+  else if (isG && (code == 2 || code == 3)) {
+    // Arc (pen down), G2 clockwise, G3 counterclockwise
+    gcodeLog("  -> Arc (pen down)");
+    float i, j;
+    if (!arcCenterOffset(&block, x, y, code == 2, &i, &j)) {
+      gcodeLog("  -> Invalid arc: ", line);
+      return false;
+    }
+    penDown();
+    arcTo(x, y, i, j, code == 2);
+    return true;
+  }
+  else if (isG && code == 28) {
     // Home all axes
-    Serial.println("  -> Homing");
+    gcodeLog("  -> Homing");
     homeMotors();
     return true;
   }
-  else if (command == "G90") {
+  else if (isG && code == 90) {
     // Absolute positioning mode
-    Serial.println("  -> Absolute mode");
+    gcodeLog("  -> Absolute mode");
     absoluteMode = true;
     return true;
   }
-  else if (command == "G91") {
+  else if (isG && code == 91) {
     // Relative positioning mode
-    Serial.println("  -> Relative mode");
+    gcodeLog("  -> Relative mode");
     absoluteMode = false;
     return true;
   }
-  else if (command == "M3") {
+  else if (isM && code == 3) {
     // Pen down
-    Serial.println("  -> Pen down");
+    gcodeLog("  -> Pen down");
     penDown();
     return true;
   }
-  else if (command == "M5") {
+  else if (isM && code == 5) {
     // Pen up
-    Serial.println("  -> Pen up");
+    gcodeLog("  -> Pen up");
     penUp();
     return true;
   }
-  else if (command == "M114") {
+  else if (isM && code == 114) {
     // Get current position
-    Serial.print("  -> Position: X=");
-    Serial.print(currentX);
-    Serial.print(" Y=");
-    Serial.print(currentY);
-    Serial.print(" Z=");
-    Serial.println(currentZ);
+    if (!dryRunActive) {
+      Serial.print("  -> Position: X=");
+      Serial.print(stepsToMm(AXIS_X, plannedSteps[AXIS_X]));
+      Serial.print(" Y=");
+      Serial.print(stepsToMm(AXIS_Y, plannedSteps[AXIS_Y]));
+      Serial.print(" Z=");
+      Serial.println(stepsToMm(AXIS_Z, plannedSteps[AXIS_Z]));
+    }
     return true;
   }
-  else if (command == "M18" || command == "M84") {
+  else if (isM && (code == 18 || code == 84)) {
     // Disable motors
-    Serial.println("  -> Motors disabled");
-    stopAllMotors();
+    gcodeLog("  -> Motors disabled");
+    plannerSynchronize();
+    if (!dryRunActive) stopAllMotors();
     return true;
   }
   else {
-    Serial.print("  -> Unknown command: ");
-    Serial.println(command);
+    gcodeLog("  -> Unknown command: ", line);
     return false;
   }
 }
 
-/**
- * Parse and execute multiple lines of G-code
- * @param gcode Multi-line G-code string
- * @return Number of lines executed successfully
- */
-int executeGCodeBlock(String gcode) {
-  int linesExecuted = 0;
-  int startIndex = 0;
-
-  while (startIndex < gcode.length()) {
-    int endIndex = gcode.indexOf('\n', startIndex);
-    if (endIndex == -1) {
-      endIndex = gcode.length();
-    }
-
-    String line = gcode.substring(startIndex, endIndex);
-
-    if (executeGCode(line)) {
-      linesExecuted++;
-    }
-
-    startIndex = endIndex + 1;
-  }
-
-  return linesExecuted;
-}
-
 #endif // GCODE_PARSER_H
@@ -0,0 +1,194 @@
+#ifndef GCODE_STREAM_H
+#define GCODE_STREAM_H
+
+#include <Arduino.h>
+#include "gcode_parser.h"
+
+// Streaming settings
+#define GCODE_LINE_MAX 96               // Longest accepted G-code line (incl. terminator)
+#define GCODE_LINE_RING_SIZE 32         // Complete lines buffered ahead of execution
+
+// Bounded ring of complete lines waiting to be executed. The HTTP side
+// (network task) writes lineRingHead, the motion task writes lineRingTail.
+char gcodeLineRing[GCODE_LINE_RING_SIZE][GCODE_LINE_MAX];
+volatile uint8_t lineRingHead = 0;
+volatile uint8_t lineRingTail = 0;
+
+// Line being assembled across chunk boundaries
+char partialLine[GCODE_LINE_MAX];
+size_t partialLength = 0;
+bool partialOverflow = false;
+
+// Set from the start of a /gcode upload until its body has been queued
+volatile bool gcodeStreamOpen = false;
+
+// Set when a stop or serial reset cancels the stream while its body is
+// still arriving: the rest of the upload is dropped
+volatile bool streamCancelled = false;
+
+// Called while an upload waits for ring space, so the network task keeps
+// serving DNS and telemetry (set in setup())
+void (*gcodeStreamWaitHook)() = NULL;
+
+// Counters for the current stream
+volatile int streamLinesQueued = 0;
+volatile int streamLinesExecuted = 0;
+volatile int streamLinesFailed = 0;
+size_t streamBytesReceived = 0;
+
+// Set by the motion task while it has lines or moves in hand
+volatile bool motionBusy = false;
+
+// Set by the HTTP side to drop buffered lines and stop; cleared by the
+// motion task once the motors are at rest
+volatile bool streamAbortRequested = false;
+
+uint8_t lineRingNextIndex(uint8_t index) {
+  return (index + 1) % GCODE_LINE_RING_SIZE;
+}
+
+bool lineRingEmpty() {
+  return lineRingHead == lineRingTail;
+}
+
+bool lineRingFull() {
+  return lineRingNextIndex(lineRingHead) == lineRingTail;
+}
+
+/**
+ * Execute the oldest buffered line (motion task only)
+ * @return false if the ring was empty
+ */
+bool gcodeStreamExecuteNext() {
+  if (streamAbortRequested) {
+    lineRingTail = lineRingHead;
+    simplifyDiscard();
+    motionStopAndFlush();
+    motionAbortRequested = false;
+    streamAbortRequested = false;
+  }
+  if (lineRingEmpty()) return false;
+
+  motionBusy = true;
+  if (executeGCode(gcodeLineRing[lineRingTail])) {
+    streamLinesExecuted++;
+  } else {
+    streamLinesFailed++;
+  }
+  __sync_synchronize();
+  lineRingTail = lineRingNextIndex(lineRingTail);
+  return true;
+}
+
+/**
+ * True while a stream is being received or has lines left to execute
+ */
+bool gcodeStreamActive() {
+  return gcodeStreamOpen || !lineRingEmpty() || streamAbortRequested;
+}
+
+/**
+ * Block until the ring has room for another line, or the stream is
+ * cancelled. While the ring is full the HTTP handler (and the TCP
+ * connection feeding it) waits for the motion task to catch up; DNS and
+ * telemetry are still served from gcodeStreamWaitHook, and a stop can
+ * arrive over Serial or the telemetry WebSocket.
+ * @return false if the stream was cancelled
+ */
+bool gcodeStreamWaitForSpace() {
+  while (lineRingFull() && !streamCancelled) {
+    if (gcodeStreamWaitHook != NULL) gcodeStreamWaitHook();
+    vTaskDelay(1);
+  }
+  return !streamCancelled;
+}
+
+/**
+ * Move the assembled line into the ring
+ */
+void gcodeStreamPushPartial() {
+  if (partialOverflow) {
+    Serial.println("  -> Line too long, skipped");
+    streamLinesFailed++;
+  } else if (partialLength > 0 && gcodeStreamWaitForSpace()) {
+    memcpy(gcodeLineRing[lineRingHead], partialLine, partialLength);
+    gcodeLineRing[lineRingHead][partialLength] = '\0';
+    __sync_synchronize();
+    lineRingHead = lineRingNextIndex(lineRingHead);
+    streamLinesQueued++;
+  }
+
+  partialLength = 0;
+  partialOverflow = false;
+}
+
+/**
+ * Start a new stream
+ */
+void gcodeStreamBegin() {
+  partialLength = 0;
+  partialOverflow = false;
+  streamLinesQueued = 0;
+  streamLinesExecuted = 0;
+  streamLinesFailed = 0;
+  streamBytesReceived = 0;
+  streamCancelled = false;
+  gcodeStreamOpen = true;
+}
+
+/**
+ * Split a chunk of G-code into lines. Only one chunk and GCODE_LINE_RING_SIZE
+ * lines are ever held, whatever the size of the whole job.
+ * @param data Chunk bytes (not null-terminated)
+ * @param length Chunk size
+ */
+void gcodeStreamFeed(const uint8_t* data, size_t length) {
+  streamBytesReceived += length;
+  if (streamCancelled) return;
+
+  for (size_t i = 0; i < length; i++) {
+    char c = (char)data[i];
+
+    if (c == '\n') {
+      gcodeStreamPushPartial();
+      if (streamCancelled) return;
+    } else if (c == '\r') {
+      continue;
+    } else if (partialLength < GCODE_LINE_MAX - 1) {
+      partialLine[partialLength++] = c;
+    } else {
+      partialOverflow = true;
+    }
+  }
+}
+
+/**
+ * Finish the stream: queue the last line. The motion task works through
+ * the ring after the upload has been answered.
+ */
+void gcodeStreamEnd() {
+  if (!streamCancelled) gcodeStreamPushPartial();
+  gcodeStreamOpen = false;
+}
+
+/**
+ * Drop buffered lines (upload aborted); the motion task brings the
+ * motors to a controlled stop
+ */
+void gcodeStreamAbort() {
+  partialLength = 0;
+  partialOverflow = false;
+  streamAbortRequested = true;
+  gcodeStreamOpen = false;
+}
+
+/**
+ * Cancel the stream from outside its upload (stop, serial reset): drop
+ * the buffered lines and whatever is still to arrive of the body
+ */
+void gcodeStreamCancel() {
+  streamCancelled = true;
+  streamAbortRequested = true;
+}
+
+#endif // GCODE_STREAM_H
@@ -0,0 +1,114 @@
+#ifndef GCODE_TOKENIZER_H
+#define GCODE_TOKENIZER_H
+
+#include <stdint.h>
+
+/*
+ * Single-pass G-code line tokenizer. It depends on nothing from the
+ * Arduino core, so tools/parser_bench.cpp can build it on the host.
+ */
+
+/**
+ * One parsed G-code line: the value of every letter word on it
+ */
+struct GCodeBlock {
+  uint32_t present;         // Bit (letter - 'A') is set for every word found
+  float value[26];          // Word values indexed by letter - 'A'
+};
+
+bool hasWord(const GCodeBlock* block, char letter) {
+  return block->present & (1UL << (letter - 'A'));
+}
+
+float wordValue(const GCodeBlock* block, char letter) {
+  return block->value[letter - 'A'];
+}
+
+/**
+ * Parse a decimal number (optional sign, digits, optional fraction)
+ * @param p Read position, advanced past the number
+ * @param result Parsed value
+ * @return false if no digits were found
+ */
+bool parseNumber(const char*& p, float* result) {
+  static const float pow10[] = {1e0f, 1e1f, 1e2f, 1e3f, 1e4f, 1e5f, 1e6f, 1e7f, 1e8f, 1e9f};
+
+  bool negative = false;
+  if (*p == '-' || *p == '+') {
+    negative = (*p == '-');
+    p++;
+  }
+
+  uint32_t mantissa = 0;
+  int fractionDigits = 0;
+  bool anyDigits = false;
+  bool inFraction = false;
+
+  while (true) {
+    char c = *p;
+    if (c >= '0' && c <= '9') {
+      // Ignore digits past what fits the mantissa or the pow10 table
+      // (beyond plotter resolution)
+      if (inFraction && fractionDigits == 9) {
+        // Leading zeros keep the mantissa small, so count digits too
+      } else if (mantissa < 100000000UL) {
+        mantissa = mantissa * 10 + (c - '0');
+        if (inFraction) fractionDigits++;
+      } else if (!inFraction) {
+        return false;  // Integer part too large
+      }
+      anyDigits = true;
+    } else if (c == '.' && !inFraction) {
+      inFraction = true;
+    } else {
+      break;
+    }
+    p++;
+  }
+
+  if (!anyDigits) return false;
+
+  float value = mantissa / pow10[fractionDigits];
+  *result = negative ? -value : value;
+  return true;
+}
+
+/**
+ * Tokenize one G-code line in a single pass, without copying it
+ * Letters are case-insensitive, spaces are optional, ';' starts a comment
+ * to end of line and '(...)' comments are skipped.
+ * @param line Null-terminated line
+ * @param block Filled with the words found
+ * @return false on a syntax error (letter without a number, stray character)
+ */
+bool parseGCodeLine(const char* line, GCodeBlock* block) {
+  block->present = 0;
+  const char* p = line;
+
+  while (*p) {
+    char c = *p;
+
+    if (c == ' ' || c == '\t' || c == '\r' || c == '\n') {
+      p++;
+    } else if (c == ';') {
+      break;
+    } else if (c == '(') {
+      while (*p && *p != ')') p++;
+      if (*p) p++;
+    } else {
+      if (c >= 'a' && c <= 'z') c -= 'a' - 'A';
+      if (c < 'A' || c > 'Z') return false;
+      p++;
+
+      float value;
+      if (!parseNumber(p, &value)) return false;
+
+      block->present |= 1UL << (c - 'A');
+      block->value[c - 'A'] = value;
+    }
+  }
+
+  return true;
+}
+
+#endif // GCODE_TOKENIZER_H
@@ -0,0 +1,283 @@
+#ifndef JOB_LIBRARY_H
+#define JOB_LIBRARY_H
+
+#include <Arduino.h>
+#include <LittleFS.h>
+#include "binary_job.h"
+
+// Job library settings
+#define LIBRARY_DIR "/library"
+#define LIBRARY_NAME_MAX 32             // Including the terminator
+
+/**
+ * A stored job. Kept next to its data file as /library/<id>.meta.
+ */
+struct LibraryEntry {
+  uint32_t id;
+  char name[LIBRARY_NAME_MAX];
+  uint8_t binary;           // 1 = binary job (binary_job.h), 0 = G-code
+  uint8_t optimized;        // Strokes already reordered (G-code only)
+  uint16_t reserved;
+  int32_t lines;            // Lines or binary records
+  uint32_t bytes;
+  uint32_t plotCount;
+};
+
+uint32_t nextLibraryId = 1;
+
+// Held around every .meta read and write: the network task counts plots
+// while the motion task marks entries optimized, and an update must not
+// be lost between its load and its save
+SemaphoreHandle_t libraryMutex = NULL;
+
+String libraryDataPath(uint32_t id) {
+  return String(LIBRARY_DIR) + "/" + String(id) + ".job";
+}
+
+String libraryMetaPath(uint32_t id) {
+  return String(LIBRARY_DIR) + "/" + String(id) + ".meta";
+}
+
+bool libraryReadMeta(uint32_t id, LibraryEntry* entry) {
+  File file = LittleFS.open(libraryMetaPath(id), "r");
+  if (!file) return false;
+
+  bool ok = file.read((uint8_t*)entry, sizeof(LibraryEntry)) == sizeof(LibraryEntry) && entry->id == id;
+  file.close();
+  return ok;
+}
+
+bool libraryWriteMeta(const LibraryEntry* entry) {
+  File file = LittleFS.open(libraryMetaPath(entry->id), "w");
+  if (!file) return false;
+
+  bool ok = file.write((const uint8_t*)entry, sizeof(LibraryEntry)) == sizeof(LibraryEntry);
+  file.close();
+  return ok;
+}
+
+/**
+ * Read an entry's metadata
+ * @return false if there is no such entry
+ */
+bool libraryLoad(uint32_t id, LibraryEntry* entry) {
+  xSemaphoreTake(libraryMutex, portMAX_DELAY);
+  bool ok = libraryReadMeta(id, entry);
+  xSemaphoreGive(libraryMutex);
+  return ok;
+}
+
+/**
+ * Write an entry's metadata
+ */
+bool librarySave(const LibraryEntry* entry) {
+  xSemaphoreTake(libraryMutex, portMAX_DELAY);
+  bool ok = libraryWriteMeta(entry);
+  xSemaphoreGive(libraryMutex);
+  return ok;
+}
+
+/**
+ * Count one more plot of an entry
+ */
+void libraryCountPlot(uint32_t id) {
+  LibraryEntry entry;
+  xSemaphoreTake(libraryMutex, portMAX_DELAY);
+  if (libraryReadMeta(id, &entry)) {
+    entry.plotCount++;
+    libraryWriteMeta(&entry);
+  }
+  xSemaphoreGive(libraryMutex);
+}
+
+/**
+ * Record that an entry's strokes have been reordered, and its new line
+ * count
+ */
+void libraryMarkOptimized(uint32_t id, int32_t lines) {
+  LibraryEntry entry;
+  xSemaphoreTake(libraryMutex, portMAX_DELAY);
+  if (libraryReadMeta(id, &entry)) {
+    entry.optimized = 1;
+    entry.lines = lines;
+    libraryWriteMeta(&entry);
+  }
+  xSemaphoreGive(libraryMutex);
+}
+
+/**
+ * Delete an entry and its data
+ */
+bool libraryRemove(uint32_t id) {
+  if (!LittleFS.exists(libraryMetaPath(id))) return false;
+
+  LittleFS.remove(libraryDataPath(id));
+  return LittleFS.remove(libraryMetaPath(id));
+}
+
+/**
+ * Call visit with the ID of every stored entry, in directory order
+ */
+void libraryForEach(void (*visit)(uint32_t id, void* context), void* context) {
+  File dir = LittleFS.open(LIBRARY_DIR);
+  if (!dir) return;
+
+  File file = dir.openNextFile();
+  while (file) {
+    String name = file.name();
+    file.close();
+    if (name.endsWith(".meta")) {
+      visit(name.toInt(), context);
+    }
+    file = dir.openNextFile();
+  }
+  dir.close();
+}
+
+void libraryTrackMaxId(uint32_t id, void* context) {
+  if (id >= nextLibraryId) nextLibraryId = id + 1;
+}
+
+/**
+ * Create the library directory and pick up stored entries (after the
+ * filesystem is mounted)
+ */
+void libraryInit() {
+  if (!LittleFS.exists(LIBRARY_DIR)) {
+    LittleFS.mkdir(LIBRARY_DIR);
+  }
+  libraryForEach(libraryTrackMaxId, NULL);
+}
+
+/**
+ * Append one entry as JSON to out
+ */
+void appendLibraryJson(String& out, const LibraryEntry* entry) {
+  out += "{\"id\":" + String(entry->id);
+  out += ",\"name\":\"" + String(entry->name) + "\"";
+  out += ",\"format\":\"" + String(entry->binary ? "binary" : "gcode") + "\"";
+  out += ",\"bytes\":" + String((unsigned long)entry->bytes);
+  out += ",\"lines\":" + String(entry->lines);
+  out += ",\"plots\":" + String((unsigned long)entry->plotCount);
+  out += "}";
+}
+
+/**
+ * Streams an HTTP upload into a file, counting G-code lines or checking a
+ * binary job as it goes. Shared by the job spool and the library.
+ */
+struct UploadWriter {
+  File file;
+  bool binary;
+  size_t bytes;
+  int lines;                // Lines or binary records
+  char lastChar;
+  bool failed;              // Could not create or write the file (flash full)
+  bool invalid;             // Binary upload that is not a valid job
+  BinaryScanner scanner;
+};
+
+bool uploadWriterBegin(UploadWriter* writer, const String& path, bool binary) {
+  writer->binary = binary;
+  writer->bytes = 0;
+  writer->lines = 0;
+  writer->lastChar = '\n';
+  writer->failed = false;
+  writer->invalid = false;
+  binaryScanBegin(&writer->scanner);
+
+  writer->file = LittleFS.open(path, "w");
+  writer->failed = !writer->file;
+  return !writer->failed;
+}
+
+void uploadWriterWrite(UploadWriter* writer, const uint8_t* data, size_t length) {
+  if (writer->failed) return;
+
+  if (writer->file.write(data, length) != length) {
+    writer->failed = true;
+    return;
+  }
+
+  if (writer->binary) {
+    binaryScanFeed(&writer->scanner, data, length);
+  } else {
+    for (size_t i = 0; i < length; i++) {
+      if (data[i] == '\n') writer->lines++;
+    }
+    if (length > 0) writer->lastChar = (char)data[length - 1];
+  }
+  writer->bytes += length;
+}
+
+/**
+ * Close the file. An empty, aborted, failed or invalid upload is removed.
+ * @return true if the file holds a complete job
+ */
+bool uploadWriterEnd(UploadWriter* writer, const String& path, bool aborted) {
+  if (writer->file) writer->file.close();
+
+  if (writer->binary) {
+    writer->invalid = writer->bytes > 0 && !binaryScanValid(&writer->scanner);
+    writer->lines = writer->scanner.records;
+  } else if (writer->lastChar != '\n') {
+    writer->lines++;
+  }
+
+  if (aborted || writer->failed || writer->invalid || writer->bytes == 0) {
+    LittleFS.remove(path);
+    return false;
+  }
+  return true;
+}
+
+// Library upload in progress (HTTP side)
+LibraryEntry libraryUpload;
+UploadWriter libraryWriter;
+bool libraryUploadStored = false;
+
+/**
+ * Start storing a new entry
+ * @param name Display name; characters other than letters, digits, space
+ *             and "-_." are dropped
+ */
+void libraryUploadBegin(const String& name, bool binary) {
+  memset(&libraryUpload, 0, sizeof(libraryUpload));
+  libraryUpload.id = nextLibraryId++;
+  libraryUpload.binary = binary;
+  libraryUploadStored = false;
+
+  size_t length = 0;
+  for (size_t i = 0; i < name.length() && length < LIBRARY_NAME_MAX - 1; i++) {
+    char c = name[i];
+    if (isalnum(c) || c == ' ' || c == '-' || c == '_' || c == '.') {
+      libraryUpload.name[length++] = c;
+    }
+  }
+  if (length == 0) {
+    snprintf(libraryUpload.name, LIBRARY_NAME_MAX, "job %lu", (unsigned long)libraryUpload.id);
+  }
+
+  uploadWriterBegin(&libraryWriter, libraryDataPath(libraryUpload.id), binary);
+}
+
+void libraryUploadWrite(const uint8_t* data, size_t length) {
+  uploadWriterWrite(&libraryWriter, data, length);
+}
+
+/**
+ * Finish storing the entry (or discard it)
+ * @param aborted True if the client went away mid-upload
+ */
+void libraryUploadEnd(bool aborted) {
+  if (!uploadWriterEnd(&libraryWriter, libraryDataPath(libraryUpload.id), aborted)) return;
+
+  libraryUpload.lines = libraryWriter.lines;
+  libraryUpload.bytes = libraryWriter.bytes;
+  libraryUploadStored = librarySave(&libraryUpload);
+  if (!libraryUploadStored) {
+    LittleFS.remove(libraryDataPath(libraryUpload.id));
+  }
+}
+
+#endif // JOB_LIBRARY_H
@@ -0,0 +1,720 @@
+#ifndef JOB_QUEUE_H
+#define JOB_QUEUE_H
+
+#include <Arduino.h>
+#include <LittleFS.h>
+#include "motor_control.h"
+#include "stepper.h"
+#include "motion.h"
+#include "gcode_parser.h"
+#include "gcode_stream.h"
+#include "travel_optimizer.h"
+#include "binary_job.h"
+#include "job_library.h"
+#include "dry_run.h"
+
+// Job queue settings
+#define JOB_TABLE_SIZE 16               // Queued, running and recently finished jobs
+#define JOB_SPOOL_DIR "/spool"
+#define JOB_READ_CHUNK 512              // Bytes read from flash at a time
+
+/**
+ * Encoding of a job's spool file
+ */
+enum JobFormat {
+  JOB_FORMAT_GCODE,
+  JOB_FORMAT_BINARY         // See binary_job.h
+};
+
+/**
+ * Lifecycle of a queued job
+ */
+enum JobState {
+  JOB_EMPTY,        // Unused table slot
+  JOB_UPLOADING,    // Body still being received
+  JOB_QUEUED,
+  JOB_RUNNING,
+  JOB_PAUSED,
+  JOB_DONE,
+  JOB_CANCELLED,
+  JOB_FAILED
+};
+
+const char* jobStateName(JobState state) {
+  switch (state) {
+    case JOB_UPLOADING: return "uploading";
+    case JOB_QUEUED: return "queued";
+    case JOB_RUNNING: return "running";
+    case JOB_PAUSED: return "paused";
+    case JOB_DONE: return "done";
+    case JOB_CANCELLED: return "cancelled";
+    case JOB_FAILED: return "failed";
+    default: return "empty";
+  }
+}
+
+/**
+ * One job in the table. Written by the HTTP side while uploading, by the
+ * motion task once queued; control requests are flags the motion task
+ * acts on at the next segment boundary.
+ */
+struct Job {
+  uint32_t id;
+  volatile JobState state;
+  JobFormat format;
+  size_t sizeBytes;
+  int linesTotal;           // G-code lines, or records of a binary job
+  volatile int linesDone;
+  volatile int linesFailed;
+  volatile uint32_t steps;
+  volatile bool pauseRequested;
+  volatile bool cancelRequested;
+  uint32_t libraryId;       // Library entry played, or 0 for an uploaded job
+  bool optimizeTravel;      // Reorder strokes before plotting
+  float travelBeforeMm;     // Pen-up travel as uploaded
+  float travelAfterMm;      // Pen-up travel as plotted
+  bool dryRun;              // Simulate only, see dry_run.h
+  DryRunReport estimate;    // Result of a finished dry run
+};
+
+Job jobTable[JOB_TABLE_SIZE];
+uint32_t nextJobId = 1;
+portMUX_TYPE jobMux = portMUX_INITIALIZER_UNLOCKED;
+
+// Job being executed by the motion task (or NULL)
+Job* activeJob = NULL;
+
+// Motion task read state for the active job
+File jobFile;
+uint8_t jobReadBuffer[JOB_READ_CHUNK];
+size_t jobReadLength = 0;
+size_t jobReadPos = 0;
+uint32_t jobStepsAtStart = 0;
+BinaryDecoder jobDecoder;
+
+// Machine state put back after a dry run
+struct DryRunSavedState {
+  int32_t steps[3];
+  float x, y, z;
+  PenState pen;
+  bool absolute;
+  float feed;
+};
+DryRunSavedState dryRunSaved;
+
+/**
+ * Spool file path of a job
+ */
+String jobSpoolPath(uint32_t id) {
+  return String(JOB_SPOOL_DIR) + "/" + String(id) + ".gc";
+}
+
+/**
+ * File a job is read from: its spool file or its library entry
+ */
+String jobSourcePath(const Job* job) {
+  return job->libraryId != 0 ? libraryDataPath(job->libraryId) : jobSpoolPath(job->id);
+}
+
+bool jobIsFinished(JobState state) {
+  return state == JOB_DONE || state == JOB_CANCELLED || state == JOB_FAILED;
+}
+
+/**
+ * Mount the filesystem, clear spool files left from before a reboot and
+ * open the job library
+ */
+bool jobQueueInit() {
+  // Created even if the mount fails: the library handlers still lock it
+  libraryMutex = xSemaphoreCreateMutex();
+
+  if (!LittleFS.begin(true)) {
+    return false;
+  }
+
+  if (!LittleFS.exists(JOB_SPOOL_DIR)) {
+    LittleFS.mkdir(JOB_SPOOL_DIR);
+  }
+
+  File dir = LittleFS.open(JOB_SPOOL_DIR);
+  File entry = dir.openNextFile();
+  while (entry) {
+    String path = String(JOB_SPOOL_DIR) + "/" + entry.name();
+    entry.close();
+    LittleFS.remove(path);
+    entry = dir.openNextFile();
+  }
+  dir.close();
+
+  for (int i = 0; i < JOB_TABLE_SIZE; i++) {
+    jobTable[i].state = JOB_EMPTY;
+  }
+
+  libraryInit();
+  return true;
+}
+
+/**
+ * Find a job by ID
+ */
+Job* findJob(uint32_t id) {
+  for (int i = 0; i < JOB_TABLE_SIZE; i++) {
+    if (jobTable[i].state != JOB_EMPTY && jobTable[i].id == id) {
+      return &jobTable[i];
+    }
+  }
+  return NULL;
+}
+
+/**
+ * Reserve a table slot for a new upload, reusing the oldest finished job
+ * @return NULL if every slot holds an unfinished job
+ */
+Job* createJob() {
+  Job* slot = NULL;
+
+  portENTER_CRITICAL(&jobMux);
+  for (int i = 0; i < JOB_TABLE_SIZE; i++) {
+    Job* job = &jobTable[i];
+    if (job->state == JOB_EMPTY) {
+      slot = job;
+      break;
+    }
+    if (jobIsFinished(job->state) && (slot == NULL || job->id < slot->id)) {
+      slot = job;
+    }
+  }
+
+  if (slot != NULL) {
+    slot->id = nextJobId++;
+    slot->state = JOB_UPLOADING;
+    slot->format = JOB_FORMAT_GCODE;
+    slot->libraryId = 0;
+    slot->sizeBytes = 0;
+    slot->linesTotal = 0;
+    slot->linesDone = 0;
+    slot->linesFailed = 0;
+    slot->steps = 0;
+    slot->pauseRequested = false;
+    slot->cancelRequested = false;
+    slot->optimizeTravel = true;
+    slot->travelBeforeMm = -1;
+    slot->travelAfterMm = -1;
+    slot->dryRun = false;
+  }
+  portEXIT_CRITICAL(&jobMux);
+
+  return slot;
+}
+
+/**
+ * Number of jobs waiting to run
+ */
+int jobsQueuedCount() {
+  int count = 0;
+  for (int i = 0; i < JOB_TABLE_SIZE; i++) {
+    if (jobTable[i].state == JOB_QUEUED) count++;
+  }
+  return count;
+}
+
+/**
+ * True while a job is running or paused
+ */
+bool jobActive() {
+  return activeJob != NULL;
+}
+
+/**
+ * Job progress in percent (by lines)
+ */
+int jobPercent(const Job* job) {
+  if (job->state == JOB_DONE) return 100;
+  if (job->linesTotal <= 0) return 0;
+  return (int)((long)(job->linesDone + job->linesFailed) * 100 / job->linesTotal);
+}
+
+/**
+ * Request pause, resume or cancel. Pause and cancel take effect at the next
+ * block boundary, after a controlled stop.
+ * @return false if the job does not exist or is already finished
+ */
+bool pauseJob(uint32_t id) {
+  Job* job = findJob(id);
+  if (job == NULL || (job->state != JOB_RUNNING && job->state != JOB_QUEUED)) return false;
+  if (job->dryRun) return false;  // Takes seconds, and holding would stall the virtual clock
+
+  job->pauseRequested = true;
+  if (job == activeJob) {
+    // Hold right away, even if the motion task is waiting inside a command
+    stepperHold = true;
+    job->state = JOB_PAUSED;
+  }
+  return true;
+}
+
+bool resumeJob(uint32_t id) {
+  Job* job = findJob(id);
+  if (job == NULL || jobIsFinished(job->state)) return false;
+
+  job->pauseRequested = false;
+  if (job == activeJob) {
+    stepperHold = false;
+    job->state = JOB_RUNNING;
+  }
+  return true;
+}
+
+bool cancelJob(uint32_t id) {
+  Job* job = findJob(id);
+  if (job == NULL || jobIsFinished(job->state) || job->state == JOB_UPLOADING) return false;
+
+  bool wasQueued = false;
+  bool wasActive = false;
+  portENTER_CRITICAL(&jobMux);
+  if (job->state == JOB_QUEUED) {
+    job->state = JOB_CANCELLED;
+    wasQueued = true;
+  } else if (job->state == JOB_RUNNING || job->state == JOB_PAUSED) {
+    // Checked and flagged under the lock, so a job that finishes meanwhile
+    // never leaves an abort behind for the next one
+    job->cancelRequested = true;
+    // Unwind the motion task out of whatever it is waiting on
+    motionAbortRequested = true;
+    wasActive = true;
+  }
+  portEXIT_CRITICAL(&jobMux);
+
+  if (wasQueued && job->libraryId == 0) LittleFS.remove(jobSpoolPath(job->id));
+  return wasQueued || wasActive;
+}
+
+/**
+ * Cancel the running job and every queued job
+ */
+void cancelAllJobs() {
+  for (int i = 0; i < JOB_TABLE_SIZE; i++) {
+    if (jobTable[i].state == JOB_QUEUED || jobTable[i].state == JOB_RUNNING ||
+        jobTable[i].state == JOB_PAUSED) {
+      cancelJob(jobTable[i].id);
+    }
+  }
+}
+
+/**
+ * Stop everything: cancel every job, drop any /gcode stream and unwind
+ * the motion task out of the current command
+ */
+void plotterStop() {
+  cancelAllJobs();
+  gcodeStreamCancel();
+  motionAbortRequested = true;
+}
+
+/**
+ * Read the next byte of the active job's spool file
+ * @return -1 at end of file
+ */
+int jobReadByte() {
+  if (jobReadPos >= jobReadLength) {
+    jobReadLength = jobFile.read(jobReadBuffer, JOB_READ_CHUNK);
+    jobReadPos = 0;
+    if (jobReadLength == 0) return -1;
+  }
+  return jobReadBuffer[jobReadPos++];
+}
+
+/**
+ * Read the next line of the active job's spool file
+ * @param line Receives the line, null-terminated
+ * @param maxLength Size of line
+ * @param tooLong Set if the line did not fit (its content is dropped)
+ * @return false at end of file
+ */
+bool jobReadLine(char* line, size_t maxLength, bool* tooLong) {
+  size_t length = 0;
+  bool any = false;
+  *tooLong = false;
+
+  while (true) {
+    int b = jobReadByte();
+    if (b < 0) break;
+
+    char c = (char)b;
+    any = true;
+    if (c == '\n') break;
+    if (c == '\r') continue;
+    if (length < maxLength - 1) {
+      line[length++] = c;
+    } else {
+      *tooLong = true;
+    }
+  }
+
+  line[*tooLong ? 0 : length] = '\0';
+  return any;
+}
+
+/**
+ * Switch the motion code to simulation for a dry-run job, remembering the
+ * machine state it will change
+ */
+void jobBeginDryRun() {
+  memcpy(dryRunSaved.steps, plannedSteps, sizeof(plannedSteps));
+  dryRunSaved.x = currentX;
+  dryRunSaved.y = currentY;
+  dryRunSaved.z = currentZ;
+  dryRunSaved.pen = penState;
+  dryRunSaved.absolute = absoluteMode;
+  dryRunSaved.feed = drawFeedMmMin;
+  dryRunBegin();
+  dryRunActive = true;
+}
+
+/**
+ * Keep the report and put the machine state back as it was
+ */
+void jobEndDryRun(Job* job) {
+  job->estimate = dryRunReport;
+  dryRunActive = false;
+  memcpy(plannedSteps, dryRunSaved.steps, sizeof(plannedSteps));
+  currentX = dryRunSaved.x;
+  currentY = dryRunSaved.y;
+  currentZ = dryRunSaved.z;
+  penState = dryRunSaved.pen;
+  absoluteMode = dryRunSaved.absolute;
+  drawFeedMmMin = dryRunSaved.feed;
+}
+
+/**
+ * Finish the active job and release its spool file
+ */
+void finishActiveJob(JobState state) {
+  if (activeJob->dryRun) jobEndDryRun(activeJob);
+  jobFile.close();
+  if (activeJob->libraryId == 0) LittleFS.remove(jobSpoolPath(activeJob->id));
+  activeJob->steps = stepEventCount - jobStepsAtStart;
+  portENTER_CRITICAL(&jobMux);
+  activeJob->state = state;
+  portEXIT_CRITICAL(&jobMux);
+  activeJob = NULL;
+}
+
+/**
+ * Reorder a job's strokes to cut pen-up travel before it starts
+ */
+void optimizeJobTravel(Job* job) {
+  uint32_t startTime = millis();
+  TravelReport report;
+  int lines;
+
+  if (travelOptimizeFile(jobSourcePath(job), &report, &lines)) {
+    job->linesTotal = lines;
+  }
+
+  // A library entry only needs reordering once. After a failure (memory,
+  // flash, stroke limit) it is tried again on its next plot.
+  bool settled = report.outcome == TRAVEL_REWRITTEN || report.outcome == TRAVEL_KEPT;
+  if (job->libraryId != 0 && settled) libraryMarkOptimized(job->libraryId, job->linesTotal);
+  job->travelBeforeMm = report.beforeMm;
+  job->travelAfterMm = report.afterMm;
+
+  Serial.print("Job ");
+  Serial.print(job->id);
+  Serial.print(": ");
+  if (!settled) {
+    Serial.print("strokes not reordered (");
+    Serial.print(travelOutcomeName(report.outcome));
+    Serial.println("), plotting as sent");
+    return;
+  }
+  Serial.print(report.strokes);
+  Serial.print(" strokes, pen-up travel ");
+  Serial.print(report.beforeMm, 1);
+  Serial.print(" -> ");
+  Serial.print(report.afterMm, 1);
+  Serial.print(" mm (");
+  Serial.print(millis() - startTime);
+  Serial.println(" ms)");
+}
+
+/**
+ * Oldest queued job (FIFO by ID). Dry runs go first: they only take a
+ * moment and their estimates are wanted before the real jobs run.
+ */
+Job* nextQueuedJob() {
+  Job* next = NULL;
+  for (int i = 0; i < JOB_TABLE_SIZE; i++) {
+    Job* job = &jobTable[i];
+    if (job->state != JOB_QUEUED) continue;
+    if (next == NULL || job->dryRun > next->dryRun ||
+        (job->dryRun == next->dryRun && job->id < next->id)) {
+      next = job;
+    }
+  }
+  return next;
+}
+
+/**
+ * Read the header of the active job's binary spool file
+ */
+bool jobBeginBinary() {
+  uint8_t header[BINARY_HEADER_SIZE];
+  for (int i = 0; i < BINARY_HEADER_SIZE; i++) {
+    int b = jobReadByte();
+    if (b < 0) return false;
+    header[i] = b;
+  }
+
+  uint16_t unitsPerMm;
+  if (!binaryParseHeader(header, &unitsPerMm)) return false;
+  binaryDecodeBegin(&jobDecoder, unitsPerMm);
+  return true;
+}
+
+/**
+ * Execute the next G-code line or binary record of the active job
+ * @return false at end of job
+ */
+bool jobExecuteNext() {
+  if (activeJob->format == JOB_FORMAT_BINARY) {
+    BinaryResult result = binaryExecuteNext(&jobDecoder, jobReadByte);
+    if (result == BINARY_OK) {
+      activeJob->linesDone++;
+      return true;
+    }
+    if (result == BINARY_ERROR) {
+      Serial.println("  -> Corrupt binary record, job ends here");
+      activeJob->linesFailed++;
+    }
+    return false;
+  }
+
+  char line[GCODE_LINE_MAX];
+  bool tooLong;
+  if (!jobReadLine(line, sizeof(line), &tooLong)) return false;
+
+  if (tooLong) {
+    Serial.println("  -> Line too long, skipped");
+    activeJob->linesFailed++;
+  } else if (executeGCode(line)) {
+    activeJob->linesDone++;
+  } else {
+    activeJob->linesFailed++;
+  }
+  return true;
+}
+
+/**
+ * Advance the job queue by one line (motion task only)
+ * @return true if work was done, false if idle or paused
+ */
+bool jobRunnerStep() {
+  if (activeJob == NULL) {
+    // Claim the next job under the lock so a concurrent cancel either sees
+    // it queued or running, never in between
+    portENTER_CRITICAL(&jobMux);
+    Job* job = nextQueuedJob();
+    // A dry run takes over the planner, so it waits for the motors to stop
+    if (job != NULL && job->dryRun && (stepperBusy() || simplifyPending())) job = NULL;
+    if (job != NULL) {
+      job->state = JOB_RUNNING;
+      // Left over from a cancel that raced with the previous job finishing
+      motionAbortRequested = false;
+    }
+    portEXIT_CRITICAL(&jobMux);
+    if (job == NULL) return false;
+
+    if (job->optimizeTravel && job->format == JOB_FORMAT_GCODE) {
+      optimizeJobTravel(job);
+    }
+
+    jobFile = LittleFS.open(jobSourcePath(job), "r");
+    jobReadLength = 0;
+    jobReadPos = 0;
+    if (!jobFile || (job->format == JOB_FORMAT_BINARY && !jobBeginBinary())) {
+      jobFile.close();
+      job->state = JOB_FAILED;
+      return true;
+    }
+
+    Serial.print(job->dryRun ? "Starting dry run of job " : "Starting job ");
+    Serial.println(job->id);
+
+    if (job->dryRun) jobBeginDryRun();
+    jobStepsAtStart = stepEventCount;
+    absoluteMode = true;
+    drawFeedMmMin = 0.0f;
+    activeJob = job;
+  }
+
+  activeJob->steps = stepEventCount - jobStepsAtStart;
+  if (activeJob->dryRun) dryRunYield();
+
+  if (activeJob->cancelRequested) {
+    Serial.print("Cancelling job ");
+    Serial.println(activeJob->id);
+    simplifyDiscard();
+    motionStopAndFlush();
+    motionAbortRequested = false;
+    stepperHold = false;
+    penUp();
+    finishActiveJob(JOB_CANCELLED);
+    return true;
+  }
+
+  if (activeJob->pauseRequested) {
+    // A job paused while still queued holds as soon as it starts
+    stepperHold = true;
+    activeJob->state = JOB_PAUSED;
+    return false;
+  }
+
+  if (!jobExecuteNext()) {
+    simplifyFlush();
+    plannerSynchronize();
+    if (motionAbortRequested) return true;  // Cancelled while draining
+
+    Serial.print("Job ");
+    Serial.print(activeJob->id);
+    Serial.println(" complete");
+    finishActiveJob(JOB_DONE);
+    return true;
+  }
+
+  return true;
+}
+
+// Upload in progress (HTTP side)
+Job* uploadJob = NULL;
+UploadWriter uploadWriter;
+
+/**
+ * Start spooling a new job
+ * @param format Encoding of the upload
+ * @param optimizeTravel Reorder strokes before plotting (G-code only)
+ * @param dryRun Only simulate the job to estimate it
+ * @return false if the table is full or the spool file cannot be created
+ */
+bool jobUploadBegin(JobFormat format, bool optimizeTravel, bool dryRun) {
+  uploadJob = createJob();
+  if (uploadJob == NULL) return false;
+  uploadJob->format = format;
+  uploadJob->optimizeTravel = optimizeTravel;
+  uploadJob->dryRun = dryRun;
+
+  if (!uploadWriterBegin(&uploadWriter, jobSpoolPath(uploadJob->id), format == JOB_FORMAT_BINARY)) {
+    uploadJob->state = JOB_FAILED;
+    return false;
+  }
+  return true;
+}
+
+/**
+ * Append a chunk to the job being spooled
+ */
+void jobUploadWrite(const uint8_t* data, size_t length) {
+  if (uploadJob == NULL) return;
+  uploadWriterWrite(&uploadWriter, data, length);
+  uploadJob->sizeBytes = uploadWriter.bytes;
+}
+
+/**
+ * Close the spool file and queue the job (or discard it)
+ * @param aborted True if the client went away mid-upload
+ */
+void jobUploadEnd(bool aborted) {
+  if (uploadJob == NULL) return;
+
+  if (!uploadWriterEnd(&uploadWriter, jobSpoolPath(uploadJob->id), aborted)) {
+    bool empty = uploadWriter.bytes == 0 && !uploadWriter.failed;
+    uploadJob->state = empty ? JOB_EMPTY : JOB_FAILED;
+    return;
+  }
+
+  uploadJob->linesTotal = uploadWriter.lines;
+  uploadJob->state = JOB_QUEUED;
+}
+
+/**
+ * Queue a stored job. It is plotted straight from its library file.
+ * @param dryRun Only simulate the job to estimate it
+ * @return NULL if the job table is full
+ */
+Job* jobQueueFromLibrary(const LibraryEntry* entry, bool dryRun) {
+  Job* job = createJob();
+  if (job == NULL) return NULL;
+
+  job->dryRun = dryRun;
+  job->format = entry->binary ? JOB_FORMAT_BINARY : JOB_FORMAT_GCODE;
+  job->libraryId = entry->id;
+  job->sizeBytes = entry->bytes;
+  job->linesTotal = entry->lines;
+  job->optimizeTravel = !entry->optimized;
+  job->state = JOB_QUEUED;
+  return job;
+}
+
+/**
+ * True if a queued or running job plays this library entry
+ */
+bool libraryEntryInUse(uint32_t libraryId) {
+  for (int i = 0; i < JOB_TABLE_SIZE; i++) {
+    if (jobTable[i].libraryId == libraryId && !jobIsFinished(jobTable[i].state) &&
+        jobTable[i].state != JOB_EMPTY) {
+      return true;
+    }
+  }
+  return false;
+}
+
+/**
+ * Append a dry-run report as JSON to out
+ */
+void appendDryRunJson(String& out, const DryRunReport* report) {
+  out += "{\"seconds\":" + String(report->durationUs / 1e6, 1);
+  out += ",\"stepsX\":" + String((unsigned long)report->steps[0]);
+  out += ",\"stepsY\":" + String((unsigned long)report->steps[1]);
+  out += ",\"stepsZ\":" + String((unsigned long)report->steps[2]);
+  out += ",\"penLifts\":" + String((unsigned long)report->penLifts);
+  out += ",\"penDrops\":" + String((unsigned long)report->penDrops);
+  out += ",\"drawMm\":" + String(report->drawMm, 1);
+  out += ",\"travelMm\":" + String(report->travelMm, 1);
+  if (dryRunHasBounds(report)) {
+    out += ",\"bounds\":[" + String(report->minX, 2) + "," + String(report->minY, 2) + ",";
+    out += String(report->maxX, 2) + "," + String(report->maxY, 2) + "]";
+  }
+  out += "}";
+}
+
+/**
+ * Append one job as JSON to out
+ */
+void appendJobJson(String& out, const Job* job) {
+  out += "{\"id\":" + String(job->id);
+  out += ",\"state\":\"" + String(jobStateName(job->state)) + "\"";
+  out += ",\"format\":\"" + String(job->format == JOB_FORMAT_BINARY ? "binary" : "gcode") + "\"";
+  if (job->libraryId != 0) {
+    out += ",\"libraryId\":" + String(job->libraryId);
+  }
+  out += ",\"bytes\":" + String((unsigned long)job->sizeBytes);
+  out += ",\"lines\":" + String(job->linesTotal);
+  out += ",\"linesDone\":" + String(job->linesDone);
+  out += ",\"linesFailed\":" + String(job->linesFailed);
+  out += ",\"steps\":" + String((unsigned long)job->steps);
+  out += ",\"percent\":" + String(jobPercent(job));
+  if (job->travelBeforeMm >= 0) {
+    out += ",\"travelBeforeMm\":" + String(job->travelBeforeMm, 1);
+    out += ",\"travelAfterMm\":" + String(job->travelAfterMm, 1);
+  }
+  if (job->dryRun) {
+    out += ",\"dryRun\":true";
+    if (job->state == JOB_DONE) {
+      out += ",\"estimate\":";
+      appendDryRunJson(out, &job->estimate);
+    }
+  }
+  out += "}";
+}
+
+#endif // JOB_QUEUE_H
@@ -19,7 +19,16 @@
 
 // Include our custom modules
 #include "motor_control.h"
+#include "stepper.h"
 #include "gcode_parser.h"
+#include "gcode_stream.h"
+#include "serial_stream.h"
+#include "motion_task.h"
+#include "job_queue.h"
+#include "calibration.h"
+#include "telemetry.h"
+#include "metrics.h"
+#include "trace.h"
 #include "web_interface.h"
 
 // WiFi Access Point credentials
@@ -33,70 +42,630 @@ WebServer server(80);
 DNSServer dnsServer;
 const byte DNS_PORT = 53;
 
-// Plotter state
-String plotterState = "idle";  // idle, plotting, homing
+// Lines executed since boot
 int totalLines = 0;
 
+// Set when a direct G-code stream arrives while jobs are queued or running
+bool streamRejected = false;
+
 /**
- * Serve the main HTML interface
+ * Serve the main HTML interface, gzipped, or 304 if the browser's copy is
+ * current
  */
 void handleRoot() {
-  server.send(200, "text/html", HTML_PAGE);
+  server.sendHeader("ETag", WEB_UI_ETAG);
+  server.sendHeader("Cache-Control", WEB_UI_CACHE_CONTROL);
+
+  if (server.header("If-None-Match") == WEB_UI_ETAG) {
+    server.send(304);
+    return;
+  }
+
+  server.sendHeader("Content-Encoding", "gzip");
+  server.send_P(200, "text/html", (const char*)WEB_UI_GZ, WEB_UI_GZ_LEN);
 }
 
 /**
- * Handle G-code POST requests
+ * Receive a G-code POST body chunk by chunk. Lines are handed to the motion
+ * task as they arrive; while the line buffer is full this handler blocks,
+ * which holds back the TCP connection until the plotter catches up. The
+ * request is answered once the last line is queued, not when it is plotted.
  */
-void handleGCode() {
-  if (server.method() != HTTP_POST) {
-    server.send(405, "text/plain", "Method Not Allowed");
+void handleGCodeUpload() {
+  HTTPRaw& raw = server.raw();
+
+  if (raw.status == RAW_START) {
+    // Direct G-code would interleave with the job queue or a calibration,
+    // and lines queued now would be dropped by a pending abort
+    streamRejected = jobActive() || jobsQueuedCount() > 0 || calibrationPending || calibrationActive ||
+                     streamAbortRequested;
+    if (streamRejected) return;
+
+    Serial.println("\n=== Receiving G-code ===");
+    gcodeStreamBegin();
+    plotterState = STATE_PLOTTING;
+  } else if (streamRejected) {
     return;
+  } else if (raw.status == RAW_WRITE) {
+    gcodeStreamFeed(raw.buf, raw.currentSize);
+  } else if (raw.status == RAW_END) {
+    gcodeStreamEnd();
+  } else if (raw.status == RAW_ABORTED) {
+    Serial.println("  -> Upload aborted");
+    gcodeStreamAbort();
   }
+}
 
-  String gcode = server.arg("plain");
+/**
+ * Handle G-code POST requests (after the body has been queued). The
+ * motion task is still plotting it; /status reports when it is done.
+ */
+void handleGCode() {
+  if (streamRejected) {
+    streamRejected = false;
+    server.send(409, "text/plain", "A job or calibration is queued or running - use /api/job or /api/stop");
+    return;
+  }
 
-  if (gcode.length() == 0) {
+  if (streamBytesReceived == 0) {
     server.send(400, "text/plain", "No G-code provided");
     return;
   }
 
-  Serial.println("\n=== Received G-code ===");
-  Serial.println(gcode);
-  Serial.println("=======================\n");
-
-  plotterState = "plotting";
-
-  // Execute the G-code
-  int linesExecuted = executeGCodeBlock(gcode);
-  totalLines += linesExecuted;
-
-  plotterState = "idle";
+  totalLines += streamLinesQueued;
 
   // Send response
-  String response = "Executed " + String(linesExecuted) + " lines successfully";
+  String response = "Queued " + String(streamLinesQueued) + " lines";
   server.send(200, "text/plain", response);
 
-  Serial.println("\n=== G-code Complete ===");
-  Serial.print("Lines executed: ");
-  Serial.println(linesExecuted);
+  Serial.println("\n=== G-code Received ===");
+  Serial.print("Bytes received: ");
+  Serial.println(streamBytesReceived);
+  Serial.print("Lines queued: ");
+  Serial.println(streamLinesQueued);
   Serial.println("=======================\n");
+
+  streamBytesReceived = 0;
+}
+
+/**
+ * Reject G-code requests that are not POSTs
+ */
+void handleMethodNotAllowed() {
+  server.send(405, "text/plain", "Method Not Allowed");
 }
 
 /**
  * Handle status requests
  */
 void handleStatus() {
+  PlotterStatus status = getPlotterStatus();
+
   String json = "{";
-  json += "\"state\":\"" + plotterState + "\",";
-  json += "\"x\":" + String(currentX, 2) + ",";
-  json += "\"y\":" + String(currentY, 2) + ",";
-  json += "\"z\":" + String(currentZ, 2) + ",";
-  json += "\"totalLines\":" + String(totalLines);
+  json += "\"state\":\"" + String(plotterStateName(status.state)) + "\",";
+  json += "\"x\":" + String(status.x, 2) + ",";
+  json += "\"y\":" + String(status.y, 2) + ",";
+  json += "\"z\":" + String(status.z, 2) + ",";
+  json += "\"totalLines\":" + String(totalLines) + ",";
+  json += "\"queued\":" + String(jobsQueuedCount()) + ",";
+  json += "\"feedOverride\":" + String(feedOverridePercent) + ",";
+  json += "\"job\":";
+  Job* job = activeJob;
+  if (job != NULL) {
+    appendJobJson(json, job);
+  } else {
+    json += "null";
+  }
   json += "}";
 
   server.send(200, "application/json", json);
 }
 
+/**
+ * Spool a job upload to flash chunk by chunk
+ */
+void spoolJobUpload(JobFormat format) {
+  HTTPRaw& raw = server.raw();
+
+  if (raw.status == RAW_START) {
+    // ?optimize=0 plots the strokes exactly in the order sent,
+    // ?dryrun=1 only estimates the job
+    jobUploadBegin(format, server.arg("optimize") != "0", server.arg("dryrun") == "1");
+  } else if (raw.status == RAW_WRITE) {
+    jobUploadWrite(raw.buf, raw.currentSize);
+  } else if (raw.status == RAW_END) {
+    jobUploadEnd(false);
+  } else if (raw.status == RAW_ABORTED) {
+    jobUploadEnd(true);
+  }
+}
+
+/**
+ * Answer a job upload: the job is queued and runs in the background
+ */
+void handleJobSubmit() {
+  if (uploadJob == NULL) {
+    server.send(503, "text/plain", "Job queue full");
+    return;
+  }
+  if (uploadWriter.failed) {
+    server.send(507, "text/plain", "Not enough flash to spool job - stream it to /gcode instead");
+    return;
+  }
+  if (uploadWriter.invalid) {
+    server.send(400, "text/plain", "Not a valid binary job (see binary_job.h)");
+    return;
+  }
+  if (uploadJob->state != JOB_QUEUED) {
+    server.send(400, "text/plain", "No G-code provided");
+    return;
+  }
+
+  Serial.print("Queued job ");
+  Serial.print(uploadJob->id);
+  Serial.print(" (");
+  Serial.print(uploadJob->linesTotal);
+  Serial.println(" lines)");
+
+  String json;
+  appendJobJson(json, uploadJob);
+  server.send(202, "application/json", json);
+}
+
+/**
+ * Job named by the id argument, or the active job if none is given
+ */
+Job* requestedJob() {
+  if (server.hasArg("id")) {
+    return findJob(server.arg("id").toInt());
+  }
+  return activeJob;
+}
+
+/**
+ * GET /api/job?id=N - one job's state and progress
+ */
+void handleJobStatus() {
+  Job* job = requestedJob();
+  if (job == NULL) {
+    server.send(404, "text/plain", "No such job");
+    return;
+  }
+
+  String json;
+  appendJobJson(json, job);
+  server.send(200, "application/json", json);
+}
+
+/**
+ * GET /api/jobs - every job in the table, oldest first
+ */
+void handleJobList() {
+  String json = "[";
+  bool first = true;
+  for (uint32_t id = 1; id < nextJobId; id++) {
+    Job* job = findJob(id);
+    if (job == NULL) continue;
+    if (!first) json += ",";
+    appendJobJson(json, job);
+    first = false;
+  }
+  json += "]";
+
+  server.send(200, "application/json", json);
+}
+
+/**
+ * POST /api/job/pause, /resume, /cancel (?id=N, default: active job)
+ */
+void handleJobControl(bool (*action)(uint32_t)) {
+  Job* job = requestedJob();
+  if (job == NULL || !action(job->id)) {
+    server.send(409, "text/plain", "Job not found or not in a state for this action");
+    return;
+  }
+
+  String json;
+  appendJobJson(json, job);
+  server.send(200, "application/json", json);
+}
+
+/**
+ * POST /api/stop - cancel every job and any direct G-code stream
+ */
+void handleStop() {
+  Serial.println("Stop requested");
+  plotterStop();
+  server.send(200, "text/plain", "Stopping");
+}
+
+/**
+ * Store an upload in the job library chunk by chunk
+ */
+void storeLibraryUpload(bool binary) {
+  HTTPRaw& raw = server.raw();
+
+  if (raw.status == RAW_START) {
+    libraryUploadBegin(server.arg("name"), binary);
+  } else if (raw.status == RAW_WRITE) {
+    libraryUploadWrite(raw.buf, raw.currentSize);
+  } else if (raw.status == RAW_END) {
+    libraryUploadEnd(false);
+  } else if (raw.status == RAW_ABORTED) {
+    libraryUploadEnd(true);
+  }
+}
+
+/**
+ * POST /api/library?name=... - answer a library upload
+ */
+void handleLibraryStore() {
+  if (libraryWriter.failed) {
+    server.send(507, "text/plain", "Not enough flash to store job");
+    return;
+  }
+  if (libraryWriter.invalid) {
+    server.send(400, "text/plain", "Not a valid binary job (see binary_job.h)");
+    return;
+  }
+  if (!libraryUploadStored) {
+    server.send(400, "text/plain", "No G-code provided");
+    return;
+  }
+
+  Serial.print("Stored library job ");
+  Serial.print(libraryUpload.id);
+  Serial.print(": ");
+  Serial.println(libraryUpload.name);
+
+  String json;
+  appendLibraryJson(json, &libraryUpload);
+  server.send(201, "application/json", json);
+}
+
+void appendLibraryEntryToList(uint32_t id, void* context) {
+  String* json = (String*)context;
+  LibraryEntry entry;
+  if (!libraryLoad(id, &entry)) return;
+
+  if (json->length() > 1) *json += ",";
+  appendLibraryJson(*json, &entry);
+}
+
+/**
+ * GET /api/library - every stored job
+ */
+void handleLibraryList() {
+  String json = "[";
+  libraryForEach(appendLibraryEntryToList, &json);
+  json += "]";
+  server.send(200, "application/json", json);
+}
+
+/**
+ * DELETE /api/library?id=N
+ */
+void handleLibraryDelete() {
+  uint32_t id = server.arg("id").toInt();
+  if (libraryEntryInUse(id)) {
+    server.send(409, "text/plain", "Job is queued or plotting");
+    return;
+  }
+  if (!libraryRemove(id)) {
+    server.send(404, "text/plain", "No such library job");
+    return;
+  }
+  server.send(200, "text/plain", "Deleted");
+}
+
+/**
+ * POST /api/library/plot?id=N - queue a stored job; it streams from flash.
+ * With &dryrun=1 the job is only estimated.
+ */
+void handleLibraryPlot() {
+  LibraryEntry entry;
+  if (!libraryLoad(server.arg("id").toInt(), &entry)) {
+    server.send(404, "text/plain", "No such library job");
+    return;
+  }
+
+  bool dryRun = server.arg("dryrun") == "1";
+  Job* job = jobQueueFromLibrary(&entry, dryRun);
+  if (job == NULL) {
+    server.send(503, "text/plain", "Job queue full");
+    return;
+  }
+  if (!dryRun) libraryCountPlot(entry.id);
+
+  String json;
+  appendJobJson(json, job);
+  server.send(202, "application/json", json);
+}
+
+/**
+ * Report or set the telemetry push rate (?hz=1..50)
+ */
+void handleTelemetry() {
+  if (server.method() == HTTP_POST && !setTelemetryHz(server.arg("hz").toInt())) {
+    server.send(400, "text/plain", "hz must be " + String(TELEMETRY_MIN_HZ) + "-" + String(TELEMETRY_MAX_HZ));
+    return;
+  }
+
+  String json = "{\"hz\":" + String(telemetryHz);
+  json += ",\"port\":" + String(TELEMETRY_PORT);
+  json += ",\"clients\":" + String(telemetryServer.connectedClients()) + "}";
+  server.send(200, "application/json", json);
+}
+
+/**
+ * Report or set the feed override (?percent=10..200). Takes effect on
+ * the moves already queued, mid-job.
+ */
+void handleFeed() {
+  if (server.method() == HTTP_POST && !setFeedOverride(server.arg("percent").toInt())) {
+    server.send(400, "text/plain", "percent must be " + String(FEED_OVERRIDE_MIN) + "-" + String(FEED_OVERRIDE_MAX));
+    return;
+  }
+
+  String json = "{\"percent\":" + String(feedOverridePercent);
+  json += ",\"feed\":" + String(drawFeedMmMin, 1) + "}";
+  server.send(200, "application/json", json);
+}
+
+/**
+ * Axis named by the axis argument (x, y or z)
+ * @return Axis index, or -1 if missing or unknown
+ */
+int requestedAxis() {
+  String axis = server.arg("axis");
+  axis.toLowerCase();
+  if (axis == "x") return AXIS_X;
+  if (axis == "y") return AXIS_Y;
+  if (axis == "z") return AXIS_Z;
+  return -1;
+}
+
+/**
+ * Per-axis step limits in use, as JSON
+ */
+void appendCalibrationJson(String& out) {
+  out += "{\"start\":[";
+  for (int i = 0; i < 3; i++) {
+    if (i > 0) out += ",";
+    out += String(axisStartDelayUs[i]);
+  }
+  out += "],\"cruise\":[";
+  for (int i = 0; i < 3; i++) {
+    if (i > 0) out += ",";
+    out += String(axisCruiseDelayUs[i]);
+  }
+  out += "]}";
+}
+
+/**
+ * POST /api/calibrate?axis=x|y|z&mode=start|cruise - plot a calibration
+ * pattern (see calibration.h). Answers with the period each row tests.
+ */
+void handleCalibrate() {
+  int axis = requestedAxis();
+  String mode = server.arg("mode");
+  if (axis < 0 || (mode != "start" && mode != "cruise")) {
+    server.send(400, "text/plain", "axis must be x, y or z and mode start or cruise");
+    return;
+  }
+  if (jobActive() || jobsQueuedCount() > 0 || plotterState != STATE_IDLE ||
+      !calibrationRequest(axis, mode == "cruise" ? CALIBRATE_CRUISE : CALIBRATE_START)) {
+    server.send(409, "text/plain", "Plotter is busy");
+    return;
+  }
+
+  String json = "{\"axis\":\"" + server.arg("axis") + "\",\"mode\":\"" + mode + "\",\"rows\":[";
+  for (int row = 0; row < CALIBRATION_ROWS; row++) {
+    if (row > 0) json += ",";
+    json += String(calibrationDelaysUs[row]);
+  }
+  json += "]}";
+  server.send(202, "application/json", json);
+}
+
+/**
+ * POST /api/calibrate/result?axis=&mode=&row=N - store the reading of a
+ * pattern: N is the last row (from 0) whose marks line up
+ */
+void handleCalibrateResult() {
+  int axis = requestedAxis();
+  String mode = server.arg("mode");
+  if (axis < 0 || (mode != "start" && mode != "cruise") || !server.hasArg("row")) {
+    server.send(400, "text/plain", "axis, mode and row are required");
+    return;
+  }
+  // A running pattern restores the limits it found when it ends, which
+  // would overwrite the result
+  if (calibrationActive || calibrationPending) {
+    server.send(409, "text/plain", "Calibration is running");
+    return;
+  }
+  if (!calibrationApply(axis, mode == "cruise" ? CALIBRATE_CRUISE : CALIBRATE_START,
+                        server.arg("row").toInt())) {
+    server.send(400, "text/plain", "row must be 0-" + String(CALIBRATION_ROWS - 1) + " (or NVS write failed)");
+    return;
+  }
+
+  String json;
+  appendCalibrationJson(json);
+  server.send(200, "application/json", json);
+}
+
+/**
+ * GET /api/calibration - step limits in use; DELETE resets them to the
+ * defaults
+ */
+void handleCalibration() {
+  if (server.method() == HTTP_DELETE) {
+    if (calibrationActive || calibrationPending) {
+      server.send(409, "text/plain", "Calibration is running");
+      return;
+    }
+    calibrationReset();
+  }
+
+  String json;
+  appendCalibrationJson(json);
+  server.send(200, "application/json", json);
+}
+
+#if PLOTTER_TRACE
+/**
+ * Trace capture state, as JSON
+ */
+void sendTraceStatus(int code) {
+  String json = "{\"armed\":" + String(traceArmed ? "true" : "false");
+  json += ",\"mode\":\"" + String(traceModeName(traceMode)) + "\"";
+  json += ",\"capacity\":" + String(traceCapacity);
+  json += ",\"recorded\":" + String(traceWritten);
+  json += ",\"events\":" + String(traceEventCount()) + "}";
+  server.send(code, "application/json", json);
+}
+
+/**
+ * POST /api/trace?mode=once|ring|underrun&events=N - start a step-timing
+ * capture (see trace.h); GET /api/trace/status reports on it
+ */
+void handleTraceStart() {
+  String mode = server.arg("mode");
+  uint32_t events = server.hasArg("events") ? server.arg("events").toInt() : TRACE_DEFAULT_EVENTS;
+  if ((mode != "" && mode != "once" && mode != "ring" && mode != "underrun") ||
+      events < 1 || events > TRACE_MAX_EVENTS) {
+    server.send(400, "text/plain", "mode must be once, ring or underrun and events 1-" + String(TRACE_MAX_EVENTS));
+    return;
+  }
+  TraceMode requested = mode == "ring" ? TRACE_RING : mode == "underrun" ? TRACE_UNDERRUN_STOP : TRACE_ONCE;
+  if (!traceStart(requested, events)) {
+    server.send(507, "text/plain", "Not enough memory for " + String(events) + " events");
+    return;
+  }
+  sendTraceStatus(200);
+}
+
+/**
+ * POST /api/trace/stop - end the capture, keeping what was recorded
+ */
+void handleTraceStop() {
+  traceStop();
+  sendTraceStatus(200);
+}
+
+/**
+ * GET /api/trace - stop the capture and download it: a TraceHeader, then
+ * the events oldest first. DELETE /api/trace frees the buffer.
+ */
+void handleTraceDump() {
+  if (server.method() == HTTP_DELETE) {
+    traceClear();
+    sendTraceStatus(200);
+    return;
+  }
+  traceStop();
+  if (traceBuffer == NULL) {
+    server.send(404, "text/plain", "No trace captured");
+    return;
+  }
+
+  uint32_t count = traceEventCount();
+  uint32_t oldest = traceOldestIndex();
+  TraceHeader header = {{'P', 'T', 'R', 'C'}, TRACE_VERSION, sizeof(TraceEvent), 0, count, traceWritten - count};
+
+  // The ring may wrap: send the part from the oldest event to the end of
+  // the buffer, then the part from its start
+  uint32_t firstPart = min(count, traceCapacity - oldest);
+  server.setContentLength(sizeof(header) + count * sizeof(TraceEvent));
+  server.sendHeader("Content-Disposition", "attachment; filename=\"trace.bin\"");
+  server.send(200, "application/octet-stream", "");
+  server.sendContent((const char*)&header, sizeof(header));
+  server.sendContent((const char*)&traceBuffer[oldest], firstPart * sizeof(TraceEvent));
+  if (count > firstPart) {
+    server.sendContent((const char*)traceBuffer, (count - firstPart) * sizeof(TraceEvent));
+  }
+}
+#endif
+
+/**
+ * GET /metrics - Prometheus text format: hot-path timers (metrics.h),
+ * heap and stack headroom, and a few counters
+ */
+void handleMetrics() {
+  String out;
+  out.reserve(METRICS_PAGE_SIZE);
+
+#if PLOTTER_METRICS
+  appendMetricsTimers(out);
+#endif
+  appendMetricsValue(out, "plotter_heap_free_bytes", "gauge", "Free heap", ESP.getFreeHeap());
+  appendMetricsValue(out, "plotter_heap_min_free_bytes", "gauge", "Lowest free heap since boot", ESP.getMinFreeHeap());
+  appendMetricsValue(out, "plotter_heap_max_alloc_bytes", "gauge", "Largest allocatable heap block", ESP.getMaxAllocHeap());
+  appendMetricsValue(out, "plotter_motion_stack_free_bytes", "gauge", "Lowest free stack of the motion task",
+                     uxTaskGetStackHighWaterMark(motionTaskHandle));
+  appendMetricsValue(out, "plotter_uptime_seconds", "counter", "Seconds since boot", millis() / 1000);
+  appendMetricsValue(out, "plotter_step_events_total", "counter", "Step events output", stepEventCount);
+  appendMetricsValue(out, "plotter_gcode_lines_total", "counter", "G-code lines streamed to /gcode", totalLines);
+  appendMetricsValue(out, "plotter_jobs_queued", "gauge", "Jobs waiting to run", jobsQueuedCount());
+
+  server.send(200, "text/plain; version=0.0.4", out);
+}
+
+/**
+ * Wrap a route handler so its run time is recorded in /metrics
+ */
+WebServer::THandlerFunction timed(WebServer::THandlerFunction handler) {
+#if PLOTTER_METRICS
+  return [handler]() {
+    METRICS_START(start);
+    handler();
+    METRICS_STOP(httpHandlerTimer, start);
+  };
+#else
+  return handler;
+#endif
+}
+
+/**
+ * Network task: DNS, HTTP and everything they trigger run here, on the
+ * WiFi core, so they stay responsive while the motion task plots
+ */
+void networkTask(void* parameter) {
+#if PLOTTER_METRICS
+  uint32_t lastPass = metricsCycles();
+#endif
+  for (;;) {
+#if PLOTTER_METRICS
+    uint32_t passStart = metricsCycles();
+    metricsRecord(&networkLoopTimer, passStart - lastPass);
+    lastPass = passStart;
+#endif
+
+    // Handle DNS requests for captive portal
+    dnsServer.processNextRequest();
+
+    // Handle web server requests
+    server.handleClient();
+
+    // Push telemetry frames to WebSocket clients
+    telemetryLoop();
+
+    // Let the WiFi stack and idle task run
+    vTaskDelay(pdMS_TO_TICKS(2));
+  }
+}
+
+/**
+ * Keep DNS and telemetry going while a /gcode upload holds the network
+ * task waiting for line buffer space
+ */
+void networkWaitHook() {
+  dnsServer.processNextRequest();
+  telemetryLoop();
+}
+
 /**
  * Handle 404 errors - redirect to root for captive portal
  */
@@ -120,9 +689,22 @@ void setup() {
   Serial.println("========================================");
   Serial.println();
 
+#if PLOTTER_METRICS
+  metricsBegin();
+#endif
+
   // Initialize motors
   Serial.println("[1/3] Initializing motors...");
   initMotors();
+  if (calibrationLoad()) {
+    Serial.println("      ✓ Calibrated step rates loaded");
+  }
+  if (jobQueueInit()) {
+    Serial.println("      ✓ Job spool mounted");
+  } else {
+    Serial.println("      ⚠ Error mounting job spool (LittleFS)");
+  }
+  startMotionTask();
   Serial.println("      ✓ Motors ready");
   Serial.println();
 
@@ -159,13 +741,51 @@ void setup() {
 
   // Set up web server routes
   Serial.println("[5/5] Starting web server...");
-  server.on("/", handleRoot);
-  server.on("/gcode", handleGCode);
-  server.on("/status", handleStatus);
-  server.onNotFound(handleNotFound);
+  static const char* collectedHeaders[] = {"If-None-Match"};
+  server.collectHeaders(collectedHeaders, 1);
+  server.on("/", timed(handleRoot));
+  server.on("/gcode", HTTP_POST, timed(handleGCode), handleGCodeUpload);
+  server.on("/gcode", HTTP_ANY, timed(handleMethodNotAllowed));
+  server.on("/status", timed(handleStatus));
+  server.on("/api/status", timed(handleStatus));
+  server.on("/api/job", HTTP_POST, timed(handleJobSubmit), []() { spoolJobUpload(JOB_FORMAT_GCODE); });
+  server.on("/api/gcode", HTTP_POST, timed(handleJobSubmit), []() { spoolJobUpload(JOB_FORMAT_GCODE); });
+  server.on("/api/job/binary", HTTP_POST, timed(handleJobSubmit), []() { spoolJobUpload(JOB_FORMAT_BINARY); });
+  server.on("/api/job", HTTP_GET, timed(handleJobStatus));
+  server.on("/api/jobs", HTTP_GET, timed(handleJobList));
+  server.on("/api/job/pause", HTTP_POST, timed([]() { handleJobControl(pauseJob); }));
+  server.on("/api/job/resume", HTTP_POST, timed([]() { handleJobControl(resumeJob); }));
+  server.on("/api/job/cancel", HTTP_POST, timed([]() { handleJobControl(cancelJob); }));
+  server.on("/api/stop", HTTP_POST, timed(handleStop));
+  server.on("/api/library", HTTP_POST, timed(handleLibraryStore), []() { storeLibraryUpload(false); });
+  server.on("/api/library/binary", HTTP_POST, timed(handleLibraryStore), []() { storeLibraryUpload(true); });
+  server.on("/api/library", HTTP_GET, timed(handleLibraryList));
+  server.on("/api/library", HTTP_DELETE, timed(handleLibraryDelete));
+  server.on("/api/library/plot", HTTP_POST, timed(handleLibraryPlot));
+  server.on("/api/telemetry", HTTP_GET, timed(handleTelemetry));
+  server.on("/api/telemetry", HTTP_POST, timed(handleTelemetry));
+  server.on("/api/feed", HTTP_GET, timed(handleFeed));
+  server.on("/api/feed", HTTP_POST, timed(handleFeed));
+  server.on("/api/calibrate", HTTP_POST, timed(handleCalibrate));
+  server.on("/api/calibrate/result", HTTP_POST, timed(handleCalibrateResult));
+  server.on("/api/calibration", HTTP_GET, timed(handleCalibration));
+  server.on("/api/calibration", HTTP_DELETE, timed(handleCalibration));
+  server.on("/metrics", HTTP_GET, timed(handleMetrics));
+#if PLOTTER_TRACE
+  server.on("/api/trace", HTTP_POST, timed(handleTraceStart));
+  server.on("/api/trace/stop", HTTP_POST, timed(handleTraceStop));
+  server.on("/api/trace/status", HTTP_GET, timed([]() { sendTraceStatus(200); }));
+  server.on("/api/trace", HTTP_GET, timed(handleTraceDump));
+  server.on("/api/trace", HTTP_DELETE, timed(handleTraceDump));
+#endif
+  server.onNotFound(timed(handleNotFound));
 
   server.begin();
+  telemetryBegin();
+  gcodeStreamWaitHook = networkWaitHook;
+  xTaskCreatePinnedToCore(networkTask, "network", 8192, NULL, 1, NULL, NETWORK_TASK_CORE);
   Serial.println("      ✓ Web server started on port 80");
+  Serial.println("      ✓ Telemetry WebSocket on port " + String(TELEMETRY_PORT));
   Serial.println();
 
   Serial.println("========================================");
@@ -178,21 +798,18 @@ void setup() {
   Serial.println("   http://plotter.local  (recommended)");
   Serial.println("   http://" + IP.toString());
   Serial.println("3. Start drawing and plotting!");
+  Serial.println("   (or stream G-code over this port with a grbl sender)");
   Serial.println();
   Serial.println("========================================");
   Serial.println();
+
+  // Last, so the banner a sender waits for ends the boot log
+  serialStreamBegin();
 }
 
 /**
- * Main loop - runs continuously
+ * Main loop - unused, the network and motion tasks do all the work
  */
 void loop() {
-  // Handle DNS requests for captive portal
-  dnsServer.processNextRequest();
-
-  // Handle web server requests
-  server.handleClient();
-
-  // Small delay to prevent watchdog timer issues
-  delay(10);
+  vTaskDelete(NULL);
 }
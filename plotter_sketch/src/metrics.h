@@ -0,0 +1,149 @@
+#ifndef METRICS_H
+#define METRICS_H
+
+#include <Arduino.h>
+
+/*
+ * Hot-path timers read from the CPU cycle counter. Each timer keeps a
+ * count, sum, min, max and a histogram; /metrics serves them in the
+ * Prometheus text format. platformio.ini enables them with
+ * -D PLOTTER_METRICS=1; set it to 0 to compile every timer out
+ * (METRICS_START/METRICS_STOP then expand to nothing).
+ *
+ * A timer is only ever recorded from one context (one task or the step
+ * ISR), so recording takes no lock. A scrape from the other core may see
+ * a timer half updated; the next scrape is consistent again.
+ */
+
+#ifndef PLOTTER_METRICS
+#define PLOTTER_METRICS 0
+#endif
+
+#define METRICS_BUCKETS 13
+#define METRICS_PAGE_SIZE 12288         // /metrics is about 11 KB with every timer
+
+// Histogram bucket upper bounds (microseconds); a final +Inf bucket follows
+const uint32_t metricsBucketUs[METRICS_BUCKETS] = {1, 2, 5, 10, 20, 50, 100, 200, 500, 1000, 5000, 20000, 100000};
+
+/**
+ * One instrumented code path. All times are in CPU cycles.
+ */
+struct MetricsTimer {
+  const char* name;         // Prometheus metric name, without unit suffix
+  const char* help;
+  uint32_t count;
+  uint64_t sumCycles;
+  uint32_t minCycles;
+  uint32_t maxCycles;
+  uint32_t buckets[METRICS_BUCKETS + 1];  // Not cumulative; the last is +Inf
+};
+
+/**
+ * Append one gauge or counter line with its TYPE and HELP
+ */
+void appendMetricsValue(String& out, const char* name, const char* type, const char* help, uint32_t value) {
+  out += "# HELP " + String(name) + " " + help + "\n";
+  out += "# TYPE " + String(name) + " " + type + "\n";
+  out += String(name) + " " + String(value) + "\n";
+}
+
+#if PLOTTER_METRICS
+
+#define METRICS_START(start) uint32_t start = metricsCycles()
+#define METRICS_STOP(timer, start) metricsRecord(&(timer), metricsCycles() - (start))
+
+// Bucket bounds in cycles (set by metricsBegin())
+uint32_t metricsBucketCycles[METRICS_BUCKETS];
+uint32_t metricsCyclesPerUs = 240;
+
+MetricsTimer gcodeParseTimer = {"plotter_gcode_parse", "Parsing one G-code line", 0, 0, UINT32_MAX, 0, {0}};
+MetricsTimer planTimer = {"plotter_plan", "Queueing one move in the planner, with lookahead", 0, 0, UINT32_MAX, 0, {0}};
+MetricsTimer segmentPrepTimer = {"plotter_segment_prep", "One stepperPrepBuffer() call", 0, 0, UINT32_MAX, 0, {0}};
+MetricsTimer stepIsrTimer = {"plotter_step_isr", "Step timer interrupt run time", 0, 0, UINT32_MAX, 0, {0}};
+MetricsTimer stepJitterTimer = {"plotter_step_jitter", "Deviation of a step tick from its programmed period", 0, 0, UINT32_MAX, 0, {0}};
+MetricsTimer networkLoopTimer = {"plotter_network_loop", "Time between passes of the network task, sleep included", 0, 0, UINT32_MAX, 0, {0}};
+MetricsTimer httpHandlerTimer = {"plotter_http_handler", "HTTP request handler run time", 0, 0, UINT32_MAX, 0, {0}};
+
+MetricsTimer* const metricsTimers[] = {
+  &gcodeParseTimer, &planTimer, &segmentPrepTimer, &stepIsrTimer,
+  &stepJitterTimer, &networkLoopTimer, &httpHandlerTimer
+};
+#define METRICS_TIMER_COUNT (sizeof(metricsTimers) / sizeof(metricsTimers[0]))
+
+/**
+ * Current CPU cycle count (safe in interrupts)
+ */
+inline uint32_t IRAM_ATTR metricsCycles() {
+  return ESP.getCycleCount();
+}
+
+/**
+ * Convert bucket bounds to cycles at the running CPU clock
+ */
+void metricsBegin() {
+  metricsCyclesPerUs = getCpuFrequencyMhz();
+  for (int i = 0; i < METRICS_BUCKETS; i++) {
+    metricsBucketCycles[i] = metricsBucketUs[i] * metricsCyclesPerUs;
+  }
+}
+
+/**
+ * Add one measurement. Integer only, so it may run in the step ISR.
+ */
+void IRAM_ATTR metricsRecord(MetricsTimer* timer, uint32_t cycles) {
+  timer->count++;
+  timer->sumCycles += cycles;
+  if (cycles < timer->minCycles) timer->minCycles = cycles;
+  if (cycles > timer->maxCycles) timer->maxCycles = cycles;
+
+  int bucket = 0;
+  while (bucket < METRICS_BUCKETS && cycles > metricsBucketCycles[bucket]) {
+    bucket++;
+  }
+  timer->buckets[bucket]++;
+}
+
+/**
+ * Append a timer as a Prometheus histogram in seconds, plus min and max
+ * gauges (the average is _sum / _count)
+ */
+void appendMetricsTimer(String& out, const MetricsTimer* live) {
+  MetricsTimer timer = *live;
+  float secondsPerCycle = 1.0f / (metricsCyclesPerUs * 1000000.0f);
+  String name = timer.name;
+
+  out += "# HELP " + name + "_seconds " + timer.help + "\n";
+  out += "# TYPE " + name + "_seconds histogram\n";
+  uint32_t cumulative = 0;
+  for (int i = 0; i <= METRICS_BUCKETS; i++) {
+    cumulative += timer.buckets[i];
+    out += name + "_seconds_bucket{le=\"";
+    out += i < METRICS_BUCKETS ? String(metricsBucketUs[i] / 1000000.0f, 6) : String("+Inf");
+    out += "\"} " + String(cumulative) + "\n";
+  }
+  out += name + "_seconds_sum " + String((float)(timer.sumCycles * secondsPerCycle), 9) + "\n";
+  out += name + "_seconds_count " + String(timer.count) + "\n";
+
+  out += "# TYPE " + name + "_min_seconds gauge\n";
+  out += name + "_min_seconds " + String(timer.count > 0 ? timer.minCycles * secondsPerCycle : 0.0f, 9) + "\n";
+  out += "# TYPE " + name + "_max_seconds gauge\n";
+  out += name + "_max_seconds " + String(timer.maxCycles * secondsPerCycle, 9) + "\n";
+}
+
+/**
+ * Append every timer
+ */
+void appendMetricsTimers(String& out) {
+  for (size_t i = 0; i < METRICS_TIMER_COUNT; i++) {
+    appendMetricsTimer(out, metricsTimers[i]);
+  }
+}
+
+#else
+
+#define METRICS_START(start)
+#define METRICS_STOP(timer, start)
+
+#endif // PLOTTER_METRICS
+
+#endif // METRICS_H
@@ -0,0 +1,305 @@
+#ifndef MOTION_H
+#define MOTION_H
+
+#include <Arduino.h>
+#include "motor_control.h"
+#include "planner.h"
+#include "stepper.h"
+#include "dry_run.h"
+#include "power_manager.h"
+
+// How long the motion task sleeps while waiting on the step engine.
+// The segment buffer holds ~160 ms of motion, so 1 ms keeps it topped up.
+#define MOTION_WAIT_TICKS 1
+
+// Arc segmentation
+#define ARC_CORRECTION_SEGMENTS 12      // Incremental rotations between exact ones
+#define ARC_ANGLE_EPSILON 5e-7f         // Smaller sweeps count as a full circle
+
+// Set to unwind out of the current command (job cancel / stop). Waits
+// return immediately and no further moves are queued until cleared.
+volatile bool motionAbortRequested = false;
+
+// Called on every wait, so requests that arrive while the motion task is
+// inside a long command are still acted on promptly (serial realtime
+// commands, set by serialStreamBegin())
+void (*motionWaitHook)() = NULL;
+
+// Largest distance (mm) an arc's line segments may stray from the true arc
+float arcToleranceMm = 0.02f;
+
+// Feed of pen-down moves in mm/min (modal G-code F). 0 until a program
+// sets one: draw as fast as the axes allow.
+float drawFeedMmMin = 0.0f;
+
+// Drive pen-up XY travel in full steps (half-step drawing resolution is
+// not needed there, and it covers twice the distance per step)
+bool fullStepTravel = true;
+
+/**
+ * Give the step engine time to make progress: sleep a tick, or in a dry
+ * run step out one segment on the virtual clock
+ */
+void motionWait() {
+  if (motionWaitHook != NULL) motionWaitHook();
+  if (dryRunActive) {
+    stepperDryRunConsume();
+  } else {
+    powerManagerUpdate();
+    vTaskDelay(MOTION_WAIT_TICKS);
+  }
+}
+
+/**
+ * Wait until every queued move has been stepped out
+ */
+void plannerSynchronize() {
+  while (stepperBusy() && !motionAbortRequested) {
+    stepperPrepBuffer();
+    motionWait();
+  }
+}
+
+/**
+ * Queue a move, waiting for room in the planner if needed
+ * @param feedMmS Requested speed (mm/s), 0 for a rapid
+ * @param fullStep Drive in full steps (see plannerBufferLine())
+ */
+void queueMove(long xSteps, long ySteps, long zSteps, float mmX, float mmY, float mmZ,
+               float feedMmS = 0.0f, bool fullStep = false) {
+  while (plannerIsFull() && !motionAbortRequested) {
+    stepperPrepBuffer();
+    motionWait();
+  }
+  if (motionAbortRequested) return;
+
+  plannerBufferLine(xSteps, ySteps, zSteps, mmX, mmY, mmZ, feedMmS, fullStep);
+  stepperPrepBuffer();
+}
+
+/**
+ * Queue a pen-up XY move, as much of it as possible in full steps.
+ * Full steps run between the two-coil (odd) phases, so an axis that
+ * starts on an even phase first takes one half step, and an odd number of
+ * half steps left over is finished with one more at the end. All three
+ * parts go in the direction of travel and blend in the planner.
+ * @param xSteps, ySteps Signed half-step counts, from plannedSteps
+ */
+void queueTravel(long xSteps, long ySteps) {
+  long total[2] = {xSteps, ySteps};
+  long lead[2], full[2], trail[2];
+  for (int i = 0; i < 2; i++) {
+    bool evenPhase = (plannedSteps[i] & 1) == 0;
+    lead[i] = (evenPhase && total[i] != 0) ? (total[i] > 0 ? 1 : -1) : 0;
+    trail[i] = (total[i] - lead[i]) % 2;
+    full[i] = total[i] - lead[i] - trail[i];
+  }
+
+  if (lead[0] != 0 || lead[1] != 0) {
+    queueMove(lead[0], lead[1], 0, stepsToMm(AXIS_X, lead[0]), stepsToMm(AXIS_Y, lead[1]), 0);
+  }
+  if (full[0] != 0 || full[1] != 0) {
+    queueMove(full[0], full[1], 0, stepsToMm(AXIS_X, full[0]), stepsToMm(AXIS_Y, full[1]), 0, 0.0f, true);
+  }
+  if (trail[0] != 0 || trail[1] != 0) {
+    queueMove(trail[0], trail[1], 0, stepsToMm(AXIS_X, trail[0]), stepsToMm(AXIS_Y, trail[1]), 0);
+  }
+}
+
+/**
+ * Bring the motors to a stop at the next block boundary and drop every
+ * queued move, then take the stopped position as the current position
+ */
+void motionStopAndFlush() {
+  stepperHold = true;
+  while (!stepperHoldComplete()) {
+    stepperPrepBuffer();
+    motionWait();
+  }
+  plannerReset();
+  stepperHold = false;
+  penState = PEN_UNKNOWN;  // Z may have stopped part way
+
+  portENTER_CRITICAL(&positionMux);
+  for (int i = 0; i < 3; i++) {
+    plannedSteps[i] = axisPosition[i];
+  }
+  portEXIT_CRITICAL(&positionMux);
+  currentX = stepsToMm(AXIS_X, plannedSteps[AXIS_X]);
+  currentY = stepsToMm(AXIS_Y, plannedSteps[AXIS_Y]);
+  currentZ = stepsToMm(AXIS_Z, plannedSteps[AXIS_Z]);
+}
+
+/**
+ * Wait for the pen to settle (skipped when unwinding an abort)
+ */
+void penSettle(int ms) {
+  if (ms > 0 && !motionAbortRequested) {
+    if (dryRunActive) {
+      dryRunAddTime(ms * 1000UL);
+    } else {
+      vTaskDelay(pdMS_TO_TICKS(ms));
+    }
+  }
+}
+
+/**
+ * Move to absolute position in mm
+ * Pen lifts run before the XY move and pen drops after it. The lift is
+ * stepped out before travel starts, so the pen is clear of the paper, but
+ * travel only waits for the part of the settle time that may not overlap
+ * it. XY moves are queued in the planner so consecutive moves blend
+ * through their corners.
+ * The target is rounded to whole steps as an absolute position and the
+ * move is the difference from plannedSteps, so the rounding of one move
+ * is made up by the next instead of adding up along a path.
+ * @param x Target X position
+ * @param y Target Y position
+ * @param z Target Z position (pen up/down)
+ */
+void moveTo(float x, float y, float z) {
+  // Target in steps (with inversion), and the steps needed to get there
+  int32_t target[3] = {mmToSteps(AXIS_X, x), mmToSteps(AXIS_Y, y), mmToSteps(AXIS_Z, z)};
+  int32_t xSteps = target[AXIS_X] - plannedSteps[AXIS_X];
+  int32_t ySteps = target[AXIS_Y] - plannedSteps[AXIS_Y];
+  int32_t zSteps = target[AXIS_Z] - plannedSteps[AXIS_Z];
+
+  // The planner gets the length actually stepped, not the programmed one
+  float zMm = stepsToMm(AXIS_Z, zSteps);
+
+  // Move Z first (pen up before moving, or down after)
+  if (zSteps > 0) {  // Moving pen up
+    queueMove(0, 0, zSteps, 0, 0, zMm);
+    plannerSynchronize();
+    penSettle(penUpSettleMs - penLiftOverlapMs);
+  }
+
+  if (dryRunActive) {
+    // Pen lifts run before the XY move and drops after, so it only draws
+    // if the pen is down at both ends
+    dryRunRecordMove(currentX, currentY, x, y, max(currentZ, z) <= PEN_DOWN_Z);
+  }
+
+  // Move X and Y together. Pen-up travel is a rapid, in full steps if
+  // enabled; drawing runs at the feed (without an F word, at the axis
+  // limit, still subject to the feed override).
+  if (xSteps != 0 || ySteps != 0) {
+    bool travel = max(currentZ, z) > PEN_DOWN_Z;
+    if (travel && fullStepTravel) {
+      queueTravel(xSteps, ySteps);
+    } else {
+      float feedMmS = travel ? 0.0f : (drawFeedMmMin > 0.0f ? drawFeedMmMin / 60.0f : 1e30f);
+      queueMove(xSteps, ySteps, 0, stepsToMm(AXIS_X, xSteps), stepsToMm(AXIS_Y, ySteps), 0, feedMmS);
+    }
+  }
+
+  // Move Z last if going down
+  if (zSteps < 0) {  // Moving pen down
+    queueMove(0, 0, zSteps, 0, 0, zMm);
+    plannerSynchronize();
+    penSettle(penDownSettleMs);
+  }
+
+  // Update current position
+  for (int i = 0; i < 3; i++) {
+    plannedSteps[i] = target[i];
+  }
+  currentX = x;
+  currentY = y;
+  currentZ = z;  // Always update Z to keep tracking in sync
+  PenState newPenState = z > PEN_DOWN_Z ? PEN_RAISED : PEN_LOWERED;
+  if (dryRunActive && newPenState != penState) {
+    dryRunRecordPen(newPenState == PEN_LOWERED);
+  }
+  penState = newPenState;
+}
+
+/**
+ * Draw an arc from the current position to x,y around the center at
+ * offset i,j from the start, as short lines whose chord error stays within
+ * arcToleranceMm. Each segment end is found by rotating the radius vector
+ * with a small-angle approximation, recomputed exactly every
+ * ARC_CORRECTION_SEGMENTS segments so rounding cannot build up.
+ * @param clockwise G2 (true) or G3 (false); an end equal to the start
+ *                  draws a full circle
+ */
+void arcTo(float x, float y, float i, float j, bool clockwise) {
+  float centerX = currentX + i;
+  float centerY = currentY + j;
+  float radius = sqrtf(i * i + j * j);
+
+  // Radius vectors from the center to the start and to the end
+  float rx = -i;
+  float ry = -j;
+  float endX = x - centerX;
+  float endY = y - centerY;
+
+  float angle = atan2f(rx * endY - ry * endX, rx * endX + ry * endY);
+  if (clockwise) {
+    if (angle >= -ARC_ANGLE_EPSILON) angle -= 2 * PI;
+  } else {
+    if (angle <= ARC_ANGLE_EPSILON) angle += 2 * PI;
+  }
+
+  // Longest chord whose sagitta is the tolerance: 2 * sqrt(t * (2r - t))
+  int segments = 0;
+  if (radius > arcToleranceMm) {
+    float halfChord = sqrtf(arcToleranceMm * (2 * radius - arcToleranceMm));
+    segments = (int)floorf(fabsf(0.5f * angle * radius) / halfChord);
+  }
+
+  if (segments > 1) {
+    float theta = angle / segments;
+    // Third-order Taylor terms of cos and sin of the segment angle
+    float cosT = 1.0f - 0.5f * theta * theta;
+    float sinT = theta * (1.0f - theta * theta / 6.0f);
+    int sinceCorrection = 0;
+
+    for (int n = 1; n < segments && !motionAbortRequested; n++) {
+      if (sinceCorrection < ARC_CORRECTION_SEGMENTS) {
+        float rotatedX = rx * cosT - ry * sinT;
+        ry = rx * sinT + ry * cosT;
+        rx = rotatedX;
+        sinceCorrection++;
+      } else {
+        float cosN = cosf(n * theta);
+        float sinN = sinf(n * theta);
+        rx = -i * cosN + j * sinN;
+        ry = -i * sinN - j * cosN;
+        sinceCorrection = 0;
+      }
+      moveTo(centerX + rx, centerY + ry, currentZ);
+    }
+  }
+
+  // End exactly on the programmed point
+  moveTo(x, y, currentZ);
+}
+
+/**
+ * Home all axes (return to 0,0 with pen up)
+ */
+void homeMotors() {
+  Serial.println("Homing motors...");
+  moveTo(0, 0, PEN_UP_Z);  // Keep pen up
+  plannerSynchronize();
+  Serial.println("Homing complete");
+}
+
+/**
+ * Pen up (no-op if already up)
+ */
+void penUp() {
+  if (penState == PEN_RAISED) return;
+  moveTo(currentX, currentY, PEN_UP_Z);
+}
+
+/**
+ * Pen down (no-op if already down)
+ */
+void penDown() {
+  if (penState == PEN_LOWERED) return;
+  moveTo(currentX, currentY, PEN_DOWN_Z);
+}
+
+#endif // MOTION_H
@@ -0,0 +1,138 @@
+#ifndef MOTION_TASK_H
+#define MOTION_TASK_H
+
+#include <Arduino.h>
+#include "motor_control.h"
+#include "stepper.h"
+#include "motion.h"
+#include "power_manager.h"
+#include "calibration.h"
+#include "gcode_stream.h"
+#include "serial_stream.h"
+#include "job_queue.h"
+
+// Core assignment: WiFi and the network task share core 0, G-code
+// execution, planning and the step timer ISR own core 1
+#define NETWORK_TASK_CORE 0
+#define MOTION_TASK_CORE 1
+#define MOTION_TASK_STACK 8192
+#define MOTION_TASK_PRIORITY 2          // Above the Arduino loop task
+
+/**
+ * Plotter states reported by /status
+ */
+enum PlotterState {
+  STATE_IDLE,
+  STATE_PLOTTING,
+  STATE_PAUSED,
+  STATE_HOMING,
+  STATE_SIMULATING,         // Dry run, the motors are not moving
+  STATE_CALIBRATING
+};
+
+const char* plotterStateName(PlotterState state) {
+  switch (state) {
+    case STATE_PLOTTING: return "plotting";
+    case STATE_PAUSED: return "paused";
+    case STATE_HOMING: return "homing";
+    case STATE_SIMULATING: return "simulating";
+    case STATE_CALIBRATING: return "calibrating";
+    default: return "idle";
+  }
+}
+
+/**
+ * Consistent copy of the state shared between the two cores
+ */
+struct PlotterStatus {
+  PlotterState state;
+  float x;
+  float y;
+  float z;
+};
+
+volatile PlotterState plotterState = STATE_IDLE;
+TaskHandle_t motionTaskHandle = NULL;
+
+/**
+ * Snapshot of the state and the position the motors have actually reached
+ * (safe to call from any core)
+ */
+PlotterStatus getPlotterStatus() {
+  int32_t steps[3];
+  portENTER_CRITICAL(&positionMux);
+  for (int i = 0; i < 3; i++) {
+    steps[i] = axisPosition[i];
+  }
+  portEXIT_CRITICAL(&positionMux);
+
+  PlotterStatus status;
+  status.state = plotterState;
+  status.x = stepsToMm(AXIS_X, steps[AXIS_X]);
+  status.y = stepsToMm(AXIS_Y, steps[AXIS_Y]);
+  status.z = stepsToMm(AXIS_Z, steps[AXIS_Z]);
+  return status;
+}
+
+/**
+ * Motion task: executes G-code lines streamed over HTTP and Serial and
+ * queued jobs, and keeps the step engine fed
+ */
+void motionTask(void* parameter) {
+  // Attach the step timer interrupt from this core
+  stepperInit();
+
+  bool jobWasActive = false;
+
+  for (;;) {
+    serialStreamRealtime();
+    bool worked = gcodeStreamExecuteNext() || serialStreamExecuteNext() || jobRunnerStep();
+    powerPlotterBusy = jobActive() || jobsQueuedCount() > 0 || gcodeStreamActive() ||
+                       calibrationActive || calibrationPending;
+
+    if (jobActive()) {
+      if (activeJob->dryRun) {
+        plotterState = STATE_SIMULATING;
+      } else {
+        plotterState = activeJob->state == JOB_PAUSED ? STATE_PAUSED : STATE_PLOTTING;
+      }
+      jobWasActive = true;
+    } else if (jobWasActive) {
+      plotterState = STATE_IDLE;
+      jobWasActive = false;
+    } else if (plotterState == STATE_PLOTTING && !gcodeStreamActive() && !motionBusy) {
+      // A /gcode stream has been executed and its moves stepped out
+      plotterState = STATE_IDLE;
+    }
+
+    if (!worked && calibrationPending && !jobActive() && jobsQueuedCount() == 0) {
+      plotterState = STATE_CALIBRATING;
+      calibrationRun();
+      plotterState = STATE_IDLE;
+      continue;
+    }
+
+    if (!worked) {
+      // Out of G-code for now: queue held-back moves before the planner runs dry
+      if (simplifyPending() && plannerIsEmpty()) {
+        simplifyFlush();
+      }
+      stepperPrepBuffer();
+      if (!stepperBusy()) {
+        motionBusy = false;
+      }
+      powerManagerUpdate();
+      vTaskDelay(MOTION_WAIT_TICKS);
+    }
+  }
+}
+
+/**
+ * Start the motion task on its own core
+ */
+void startMotionTask() {
+  xTaskCreatePinnedToCore(motionTask, "motion", MOTION_TASK_STACK, NULL,
+                          MOTION_TASK_PRIORITY, &motionTaskHandle, MOTION_TASK_CORE);
+}
+
+#endif // MOTION_TASK_H
@@ -2,6 +2,7 @@
 #define MOTOR_CONTROL_H
 
 #include <Arduino.h>
+#include "soc/gpio_struct.h"
 
 // Motor pin definitions
 // X-Axis
@@ -32,7 +33,9 @@
 #define X_INVERT -1             // Inverted to fix mirror image
 #define Y_INVERT 1              // Normal direction
 
-// Half-step sequence for 28BYJ-48
+// Half-step sequence for 28BYJ-48. The odd phases energize two coils
+// at once: stepping two phases at a time through them is two-phase
+// full-step drive (twice the distance per step, more torque).
 const int halfStepSequence[8][4] = {
   {1, 0, 0, 0},  // Step 0
   {1, 1, 0, 0},  // Step 1
@@ -44,18 +47,131 @@ const int halfStepSequence[8][4] = {
   {1, 0, 0, 1}   // Step 7
 };
 
-// Current step position for each motor
-int xCurrentStep = 0;
-int yCurrentStep = 0;
-int zCurrentStep = 0;
+// Axis indices used by the planner and step engine
+#define AXIS_X 0
+#define AXIS_Y 1
+#define AXIS_Z 2
 
-// Current position in mm
+// Coil pins per axis, in IN1..IN4 order
+const uint8_t coilPins[3][4] = {
+  {X_IN1, X_IN2, X_IN3, X_IN4},
+  {Y_IN1, Y_IN2, Y_IN3, Y_IN4},
+  {Z_IN1, Z_IN2, Z_IN3, Z_IN4}
+};
+
+// All coil outputs are written through GPIO.out_w1ts / out_w1tc, which
+// only cover GPIO 0-31
+#if X_IN1 > 31 || X_IN2 > 31 || X_IN3 > 31 || X_IN4 > 31 || \
+    Y_IN1 > 31 || Y_IN2 > 31 || Y_IN3 > 31 || Y_IN4 > 31 || \
+    Z_IN1 > 31 || Z_IN2 > 31 || Z_IN3 > 31 || Z_IN4 > 31
+#error "Coil pins must be GPIO 0-31"
+#endif
+
+// GPIO bits to set for each axis and phase of halfStepSequence,
+// and all four coil bits of each axis (built by buildPhaseMasks())
+uint32_t phaseSetMask[3][8];
+uint32_t axisCoilMask[3];
+uint32_t allCoilMask = 0;
+
+// Current phase (0-7) of each motor, and whether its coils are driven
+volatile int8_t axisPhase[3] = {0, 0, 0};
+volatile bool axisEnergized[3] = {false, false, false};
+
+// Steps actually output per axis since boot (updated by the step ISR).
+// Readers on the other core take positionMux to get all three together.
+volatile int32_t axisPosition[3] = {0, 0, 0};
+portMUX_TYPE positionMux = portMUX_INITIALIZER_UNLOCKED;
+
+// Position at the end of the queued moves, in steps per axis. This is
+// where the machine will be; moves are planned as differences of whole
+// steps, so no fraction of a step is ever lost.
+int32_t plannedSteps[3] = {0, 0, 0};
+
+// Programmed position in mm (what G-code coordinates are relative to).
+// Each move rounds it to plannedSteps.
 float currentX = 0.0;
 float currentY = 0.0;
 float currentZ = 0.0;
 
-// Step delay (microseconds) - controls speed
-int stepDelayUs = 2000;  // 2ms = moderate speed
+// Step periods (microseconds) per axis (X, Y, Z). The start period is the
+// fastest an axis steps from standstill; the planner accelerates from there
+// up to the cruise period. Defaults suit any 28BYJ-48; calibration.h finds
+// and stores the limits of each machine.
+#define DEFAULT_START_DELAY_US 2000     // 2ms = moderate speed
+#define DEFAULT_CRUISE_DELAY_US 800
+int axisStartDelayUs[3] = {DEFAULT_START_DELAY_US, DEFAULT_START_DELAY_US, DEFAULT_START_DELAY_US};
+int axisCruiseDelayUs[3] = {DEFAULT_CRUISE_DELAY_US, DEFAULT_CRUISE_DELAY_US, DEFAULT_CRUISE_DELAY_US};
+
+// Pen heights (mm)
+#define PEN_UP_Z 5.0f
+#define PEN_DOWN_Z 0.0f
+
+// Pen settle times (milliseconds), per direction. A lift only has to clear
+// the paper, so up to penLiftOverlapMs of its settle runs while the
+// following travel move accelerates from standstill. A drop always settles
+// fully before drawing starts.
+int penUpSettleMs = 100;
+int penDownSettleMs = 100;
+int penLiftOverlapMs = 60;
+
+/**
+ * Known pen position, so repeated pen up/down commands cost nothing
+ */
+enum PenState {
+  PEN_UNKNOWN,      // After boot or an aborted move
+  PEN_RAISED,
+  PEN_LOWERED
+};
+
+PenState penState = PEN_UNKNOWN;
+
+/**
+ * Convert a step count on an axis to mm
+ */
+float stepsToMm(int axis, long steps) {
+  if (axis == AXIS_X) return steps * (1.0f / (STEPS_PER_MM_X * X_INVERT));
+  if (axis == AXIS_Y) return steps * (1.0f / (STEPS_PER_MM_Y * Y_INVERT));
+  return steps * (1.0f / STEPS_PER_MM_Z);
+}
+
+/**
+ * Longest start period of the three axes: safe for whichever moves first
+ */
+int slowestStartDelayUs() {
+  return max(axisStartDelayUs[AXIS_X], max(axisStartDelayUs[AXIS_Y], axisStartDelayUs[AXIS_Z]));
+}
+
+/**
+ * Convert a position in mm to the nearest whole step on an axis
+ */
+int32_t mmToSteps(int axis, float mm) {
+  if (axis == AXIS_X) return lroundf(mm * (STEPS_PER_MM_X * X_INVERT));
+  if (axis == AXIS_Y) return lroundf(mm * (STEPS_PER_MM_Y * Y_INVERT));
+  return lroundf(mm * STEPS_PER_MM_Z);
+}
+
+/**
+ * Precompute the GPIO set mask of every phase of every axis
+ */
+void buildPhaseMasks() {
+  allCoilMask = 0;
+  for (int axis = 0; axis < 3; axis++) {
+    axisCoilMask[axis] = 0;
+    for (int coil = 0; coil < 4; coil++) {
+      axisCoilMask[axis] |= 1UL << coilPins[axis][coil];
+    }
+    allCoilMask |= axisCoilMask[axis];
+
+    for (int step = 0; step < 8; step++) {
+      phaseSetMask[axis][step] = 0;
+      for (int coil = 0; coil < 4; coil++) {
+        if (halfStepSequence[step][coil]) {
+          phaseSetMask[axis][step] |= 1UL << coilPins[axis][coil];
+        }
+      }
+    }
+  }
+}
 
 /**
  * Initialize all motor pins as outputs
@@ -95,154 +211,70 @@ void initMotors() {
   digitalWrite(Z_IN3, LOW);
   digitalWrite(Z_IN4, LOW);
 
-  Serial.println("Motors initialized");
-}
+  buildPhaseMasks();
 
-/**
- * Set motor coils to specific step in sequence
- */
-void setMotorStep(char axis, int step) {
-  step = step % 8;  // Ensure step is 0-7
-
-  if (axis == 'X') {
-    digitalWrite(X_IN1, halfStepSequence[step][0]);
-    digitalWrite(X_IN2, halfStepSequence[step][1]);
-    digitalWrite(X_IN3, halfStepSequence[step][2]);
-    digitalWrite(X_IN4, halfStepSequence[step][3]);
-  } else if (axis == 'Y') {
-    digitalWrite(Y_IN1, halfStepSequence[step][0]);
-    digitalWrite(Y_IN2, halfStepSequence[step][1]);
-    digitalWrite(Y_IN3, halfStepSequence[step][2]);
-    digitalWrite(Y_IN4, halfStepSequence[step][3]);
-  } else if (axis == 'Z') {
-    digitalWrite(Z_IN1, halfStepSequence[step][0]);
-    digitalWrite(Z_IN2, halfStepSequence[step][1]);
-    digitalWrite(Z_IN3, halfStepSequence[step][2]);
-    digitalWrite(Z_IN4, halfStepSequence[step][3]);
-  }
-}
-
-/**
- * Step a motor a specific number of steps
- * @param axis 'X', 'Y', or 'Z'
- * @param steps Number of steps (positive or negative)
- */
-void stepMotor(char axis, int steps) {
-  int* currentStep;
-
-  // Get pointer to current step for this axis
-  if (axis == 'X') currentStep = &xCurrentStep;
-  else if (axis == 'Y') currentStep = &yCurrentStep;
-  else if (axis == 'Z') currentStep = &zCurrentStep;
-  else return;
-
-  bool clockwise = steps > 0;
-  steps = abs(steps);
-
-  for (int i = 0; i < steps; i++) {
-    // Move to next step
-    if (clockwise) {
-      (*currentStep)++;
-      if (*currentStep >= 8) *currentStep = 0;
-    } else {
-      (*currentStep)--;
-      if (*currentStep < 0) *currentStep = 7;
-    }
-
-    // Set motor to new step
-    setMotorStep(axis, *currentStep);
-
-    // Wait before next step
-    delayMicroseconds(stepDelayUs);
-  }
+  Serial.println("Motors initialized");
 }
 
 /**
- * Move to absolute position in mm
- * @param x Target X position
- * @param y Target Y position
- * @param z Target Z position (pen up/down)
+ * Drive the coils of all three axes from their current phases.
+ * Coils that stay on are never touched: W1TC only clears coils that turn
+ * off and W1TS only sets coils that turn on, so all twelve outputs change
+ * together without a gap.
  */
-void moveTo(float x, float y, float z) {
-  // Calculate steps needed for each axis (with inversion)
-  int xSteps = (int)((x - currentX) * STEPS_PER_MM_X * X_INVERT);
-  int ySteps = (int)((y - currentY) * STEPS_PER_MM_Y * Y_INVERT);
-  int zSteps = (int)((z - currentZ) * STEPS_PER_MM_Z);
-
-  // Move Z first (pen up before moving, or down after)
-  if (zSteps > 0) {  // Moving pen up
-    stepMotor('Z', zSteps);
-    delay(100);  // Wait for pen to stabilize
-  }
-
-  // Move X and Y simultaneously (simple linear interpolation)
-  int maxSteps = max(abs(xSteps), abs(ySteps));
-
-  for (int i = 0; i < maxSteps; i++) {
-    // Step X if needed
-    if (abs(xSteps) > 0 && i < abs(xSteps)) {
-      stepMotor('X', xSteps > 0 ? 1 : -1);
-    }
-
-    // Step Y if needed
-    if (abs(ySteps) > 0 && i < abs(ySteps)) {
-      stepMotor('Y', ySteps > 0 ? 1 : -1);
+void IRAM_ATTR writeCoils() {
+  uint32_t set = 0;
+  for (int axis = 0; axis < 3; axis++) {
+    if (axisEnergized[axis]) {
+      set |= phaseSetMask[axis][axisPhase[axis]];
     }
   }
-
-  // Move Z last if going down
-  if (zSteps < 0) {  // Moving pen down
-    stepMotor('Z', zSteps);
-    delay(100);  // Wait for pen to stabilize
-  }
-
-  // Update current position
-  currentX = x;
-  currentY = y;
-  currentZ = z;  // Always update Z to keep tracking in sync
+  GPIO.out_w1tc = allCoilMask & ~set;
+  GPIO.out_w1ts = set;
 }
 
 /**
- * Home all axes (return to 0,0 with pen up)
+ * Advance a motor through the phase table. Coils are not written until
+ * the next writeCoils(). A motor's phase always equals its position
+ * modulo 8, so odd positions are the two-coil full-step phases.
+ * @param axis AXIS_X, AXIS_Y or AXIS_Z
+ * @param dir +1 or -1 for a half step, +2 or -2 for a full step
  */
-void homeMotors() {
-  Serial.println("Homing motors...");
-  moveTo(0, 0, 5.0);  // Keep pen up at Z=5mm
-  Serial.println("Homing complete");
+void IRAM_ATTR advancePhase(int axis, int dir) {
+  axisPhase[axis] = (axisPhase[axis] + dir) & 7;
+  axisPosition[axis] += dir;
+  axisEnergized[axis] = true;
 }
 
 /**
- * Pen up (Z = 5mm)
+ * Drive an axis' coils at the phase it was left in, so the rotor is held
+ * where it is before it takes its next step (motion task side)
  */
-void penUp() {
-  moveTo(currentX, currentY, 5.0);
+void energizeAxis(int axis) {
+  portENTER_CRITICAL(&positionMux);
+  axisEnergized[axis] = true;
+  writeCoils();
+  portEXIT_CRITICAL(&positionMux);
 }
 
 /**
- * Pen down (Z = 0mm)
+ * Switch one axis' coils off. Its phase is kept for energizeAxis().
  */
-void penDown() {
-  moveTo(currentX, currentY, 0.0);
+void releaseAxis(int axis) {
+  portENTER_CRITICAL(&positionMux);
+  axisEnergized[axis] = false;
+  writeCoils();
+  portEXIT_CRITICAL(&positionMux);
 }
 
 /**
  * Stop all motors (turn off coils)
  */
 void stopAllMotors() {
-  digitalWrite(X_IN1, LOW);
-  digitalWrite(X_IN2, LOW);
-  digitalWrite(X_IN3, LOW);
-  digitalWrite(X_IN4, LOW);
-
-  digitalWrite(Y_IN1, LOW);
-  digitalWrite(Y_IN2, LOW);
-  digitalWrite(Y_IN3, LOW);
-  digitalWrite(Y_IN4, LOW);
-
-  digitalWrite(Z_IN1, LOW);
-  digitalWrite(Z_IN2, LOW);
-  digitalWrite(Z_IN3, LOW);
-  digitalWrite(Z_IN4, LOW);
+  for (int axis = 0; axis < 3; axis++) {
+    axisEnergized[axis] = false;
+  }
+  GPIO.out_w1tc = allCoilMask;
 }
 
 #endif // MOTOR_CONTROL_H
@@ -0,0 +1,185 @@
+#ifndef PATH_SIMPLIFIER_H
+#define PATH_SIMPLIFIER_H
+
+#include <Arduino.h>
+#include "motor_control.h"
+#include "motion.h"
+
+// Path simplification settings
+#define SIMPLIFY_WINDOW 64              // Pen-down points held back per run
+#define SIMPLIFY_COLLINEAR_MM 0.001f    // Points this close to the line are always merged
+
+// Largest distance (mm) the simplified path may stray from the G-code path.
+// 0 only merges collinear and sub-step segments.
+float simplifyToleranceMm = 0.1f;
+
+/**
+ * A point of the pen-down run being collected
+ */
+struct SimplifyPoint {
+  float x;
+  float y;
+};
+
+// Run of consecutive XY-only G1 moves. simplifyPoints[0] is where the run
+// starts (the pen position), [1..simplifyCount] the targets kept so far.
+SimplifyPoint simplifyPoints[SIMPLIFY_WINDOW + 1];
+bool simplifyKeep[SIMPLIFY_WINDOW + 1];
+int simplifyCount = 0;
+
+// Last G1 target, kept even when it was merged as a sub-step move so the
+// run always ends exactly where the G-code asked
+SimplifyPoint simplifyTail;
+bool simplifyTailMerged = false;
+
+// Points in and segments out since boot
+uint32_t simplifyPointsIn = 0;
+uint32_t simplifyPointsOut = 0;
+
+/**
+ * True while G1 moves are held back
+ */
+bool simplifyPending() {
+  return simplifyCount > 0 || simplifyTailMerged;
+}
+
+/**
+ * Position the G-code has commanded, including moves still held back
+ */
+float simplifyCommandedX() {
+  return simplifyPending() ? simplifyTail.x : currentX;
+}
+
+float simplifyCommandedY() {
+  return simplifyPending() ? simplifyTail.y : currentY;
+}
+
+/**
+ * Distance from p to the segment a-b
+ */
+float simplifySegmentDistance(const SimplifyPoint* p, const SimplifyPoint* a, const SimplifyPoint* b) {
+  float dx = b->x - a->x;
+  float dy = b->y - a->y;
+  float lengthSquared = dx * dx + dy * dy;
+
+  float t = 0.0f;
+  if (lengthSquared > 0.0f) {
+    t = ((p->x - a->x) * dx + (p->y - a->y) * dy) / lengthSquared;
+    t = constrain(t, 0.0f, 1.0f);
+  }
+
+  float ex = a->x + t * dx - p->x;
+  float ey = a->y + t * dy - p->y;
+  return sqrtf(ex * ex + ey * ey);
+}
+
+/**
+ * Ramer-Douglas-Peucker over simplifyPoints[0..simplifyCount]: keep the
+ * point farthest from each chord while it is out of tolerance
+ */
+void simplifyMarkPoints() {
+  static uint8_t stack[2 * (SIMPLIFY_WINDOW + 1)];
+  int top = 0;
+  float tolerance = max(simplifyToleranceMm, SIMPLIFY_COLLINEAR_MM);
+
+  for (int i = 0; i <= simplifyCount; i++) {
+    simplifyKeep[i] = false;
+  }
+  simplifyKeep[0] = true;
+  simplifyKeep[simplifyCount] = true;
+
+  stack[top++] = 0;
+  stack[top++] = simplifyCount;
+
+  while (top > 0) {
+    int last = stack[--top];
+    int first = stack[--top];
+
+    float farthest = 0.0f;
+    int index = -1;
+    for (int i = first + 1; i < last; i++) {
+      float d = simplifySegmentDistance(&simplifyPoints[i], &simplifyPoints[first], &simplifyPoints[last]);
+      if (d > farthest) {
+        farthest = d;
+        index = i;
+      }
+    }
+
+    if (index >= 0 && farthest > tolerance) {
+      simplifyKeep[index] = true;
+      stack[top++] = first;
+      stack[top++] = index;
+      stack[top++] = index;
+      stack[top++] = last;
+    }
+  }
+}
+
+/**
+ * Simplify the held-back run and queue what is left of it
+ */
+void simplifyFlush() {
+  if (!simplifyPending()) return;
+
+  if (simplifyTailMerged) {
+    // End on the real target: it is less than a step from the last point
+    if (simplifyCount == 0) simplifyCount = 1;
+    simplifyPoints[simplifyCount] = simplifyTail;
+    simplifyTailMerged = false;
+  }
+
+  simplifyMarkPoints();
+
+  int count = simplifyCount;
+  simplifyCount = 0;
+  for (int i = 1; i <= count; i++) {
+    if (simplifyKeep[i]) {
+      moveTo(simplifyPoints[i].x, simplifyPoints[i].y, currentZ);
+      simplifyPointsOut++;
+    }
+  }
+}
+
+/**
+ * Hold back one pen-down XY move. Moves of less than a step on both axes
+ * are merged into the next one; the run is simplified and queued once it
+ * fills the window or something other than an XY G1 comes along.
+ */
+void simplifyAddPoint(float x, float y) {
+  simplifyPointsIn++;
+
+  if (simplifyCount == 0) {
+    simplifyPoints[0].x = currentX;
+    simplifyPoints[0].y = currentY;
+  }
+
+  const SimplifyPoint* last = &simplifyPoints[simplifyCount];
+  if (fabsf(x - last->x) * STEPS_PER_MM_X < 1.0f && fabsf(y - last->y) * STEPS_PER_MM_Y < 1.0f) {
+    simplifyTail.x = x;
+    simplifyTail.y = y;
+    simplifyTailMerged = true;
+    return;
+  }
+
+  if (simplifyCount == SIMPLIFY_WINDOW) {
+    simplifyFlush();
+    simplifyPoints[0].x = currentX;
+    simplifyPoints[0].y = currentY;
+  }
+
+  simplifyTail.x = x;
+  simplifyTail.y = y;
+  simplifyTailMerged = false;
+  simplifyCount++;
+  simplifyPoints[simplifyCount] = simplifyTail;
+}
+
+/**
+ * Drop held-back moves (stop / cancel)
+ */
+void simplifyDiscard() {
+  simplifyCount = 0;
+  simplifyTailMerged = false;
+}
+
+#endif // PATH_SIMPLIFIER_H
@@ -0,0 +1,277 @@
+#ifndef PLANNER_H
+#define PLANNER_H
+
+#include <Arduino.h>
+#include "motor_control.h"
+#include "metrics.h"
+
+// Planner settings
+#define PLANNER_BUFFER_SIZE 16          // Queued moves available for lookahead
+#define ACCELERATION_MM_S2 150.0f       // Ramp between start speed and cruise speed
+#define JUNCTION_DEVIATION_MM 0.05f     // grbl-style cornering tolerance
+#define FEED_OVERRIDE_MIN 10            // Feed override range, percent
+#define FEED_OVERRIDE_MAX 200
+
+/**
+ * One queued straight move, in steps per axis (X, Y, Z)
+ */
+struct PlannerBlock {
+  long steps[3];            // Absolute step count per axis, in units of stepSize
+  int8_t dir[3];            // +1 or -1 per axis
+  uint8_t stepSize;         // Half steps per step: 1 = half-step, 2 = full-step drive
+  long stepEventCount;      // Steps on the dominant axis (Bresenham length)
+  float millimeters;        // Path length of the move
+  float unitVec[3];         // Direction of travel in mm space
+
+  float nominalSpeed;       // Cruise speed in mm/s (feed with override, within maxSpeed)
+  float programmedSpeed;    // Requested feed in mm/s, 0 = rapid
+  float maxSpeed;           // Fastest speed the axis step rates allow (mm/s)
+  float maxJunctionSpeed;   // Cornering limit with the previous move (mm/s)
+  float startRate;          // Step events/s every axis can start at from standstill
+  float entrySpeed;         // Planned speed at the start of the move (mm/s)
+  float maxEntrySpeed;      // Junction limit with the previous move (mm/s)
+  float acceleration;       // mm/s^2
+};
+
+// Ring buffer of queued moves. plannerTail is the next move to execute,
+// plannerHead is the next free slot.
+PlannerBlock plannerBuffer[PLANNER_BUFFER_SIZE];
+volatile uint8_t plannerHead = 0;
+volatile uint8_t plannerTail = 0;
+
+// Direction of the last queued move, for junction speed
+float plannerPrevUnitVec[3] = {0, 0, 0};
+float plannerPrevNominalSpeed = 0;
+bool plannerHasPrev = false;
+
+// Feed override in percent, set from any task. The motion task applies a
+// change to the queued moves at its next stepperPrepBuffer().
+volatile int feedOverridePercent = 100;
+volatile bool feedOverrideChanged = false;
+
+uint8_t plannerNextIndex(uint8_t index) {
+  return (index + 1) % PLANNER_BUFFER_SIZE;
+}
+
+uint8_t plannerPrevIndex(uint8_t index) {
+  return (index + PLANNER_BUFFER_SIZE - 1) % PLANNER_BUFFER_SIZE;
+}
+
+bool plannerIsEmpty() {
+  return plannerHead == plannerTail;
+}
+
+bool plannerIsFull() {
+  return plannerNextIndex(plannerHead) == plannerTail;
+}
+
+/**
+ * Highest speed reachable from speed v over distance d at acceleration a
+ */
+float plannerMaxReachableSpeed(float v, float a, float d) {
+  return sqrtf(v * v + 2.0f * a * d);
+}
+
+/**
+ * Exit speed of a queued block (entry speed of the next one, or 0 at the end)
+ */
+float plannerExitSpeed(uint8_t index) {
+  uint8_t next = plannerNextIndex(index);
+  if (next == plannerHead) return 0.0f;
+  return plannerBuffer[next].entrySpeed;
+}
+
+/**
+ * Re-plan entry speeds of all queued blocks (grbl-style two-pass lookahead).
+ * The tail block's entry speed is fixed: the move before it already
+ * committed to exiting at that speed.
+ */
+void plannerRecalculate() {
+  if (plannerIsEmpty()) return;
+
+  // Reverse pass: every block must be able to decelerate to the next entry
+  // speed, and the newest block must be able to stop.
+  uint8_t index = plannerPrevIndex(plannerHead);
+  float nextEntry = 0.0f;
+  while (index != plannerTail) {
+    PlannerBlock* block = &plannerBuffer[index];
+    block->entrySpeed = min(block->maxEntrySpeed,
+                            plannerMaxReachableSpeed(nextEntry, block->acceleration, block->millimeters));
+    nextEntry = block->entrySpeed;
+    index = plannerPrevIndex(index);
+  }
+
+  // Forward pass: no block may enter faster than the previous block can
+  // accelerate to.
+  index = plannerTail;
+  uint8_t next = plannerNextIndex(index);
+  while (next != plannerHead) {
+    PlannerBlock* block = &plannerBuffer[index];
+    PlannerBlock* nextBlock = &plannerBuffer[next];
+    float reachable = plannerMaxReachableSpeed(block->entrySpeed, block->acceleration, block->millimeters);
+    if (nextBlock->entrySpeed > reachable) {
+      nextBlock->entrySpeed = reachable;
+    }
+    index = next;
+    next = plannerNextIndex(next);
+  }
+}
+
+/**
+ * Cruise speed of a block: its feed scaled by the override, never above
+ * what the axes allow. Rapids always run at the axis limit.
+ */
+float plannerNominalSpeed(const PlannerBlock* block) {
+  if (block->programmedSpeed <= 0.0f) return block->maxSpeed;
+  float speed = min(block->programmedSpeed, block->maxSpeed) * feedOverridePercent / 100.0f;
+  return min(speed, block->maxSpeed);
+}
+
+/**
+ * Queue a straight move
+ * @param xSteps, ySteps, zSteps Signed half-step counts per axis
+ * @param mmX, mmY, mmZ Same move in mm, for speed and cornering
+ * @param feedMmS Requested speed (mm/s), 0 for a rapid
+ * @param fullStep Drive in full steps; every count must be even and every
+ *                 moving axis must start on a two-coil (odd) phase
+ * @return false if the buffer is full or the move has no steps
+ */
+bool plannerBufferLine(long xSteps, long ySteps, long zSteps, float mmX, float mmY, float mmZ,
+                       float feedMmS = 0.0f, bool fullStep = false) {
+  if (plannerIsFull()) return false;
+  METRICS_START(planStart);
+
+  long stepCounts[3] = {xSteps, ySteps, zSteps};
+  float delta[3] = {mmX, mmY, mmZ};
+
+  // The step rate limits apply per phase change, so a full-step block
+  // covers twice the distance at the same step periods
+  PlannerBlock* block = &plannerBuffer[plannerHead];
+  block->stepSize = fullStep ? 2 : 1;
+  block->stepEventCount = 0;
+  for (int i = 0; i < 3; i++) {
+    block->steps[i] = labs(stepCounts[i]) / block->stepSize;
+    block->dir[i] = stepCounts[i] < 0 ? -1 : 1;
+    block->stepEventCount = max(block->stepEventCount, block->steps[i]);
+  }
+  if (block->stepEventCount == 0) return false;
+
+  block->millimeters = sqrtf(delta[0] * delta[0] + delta[1] * delta[1] + delta[2] * delta[2]);
+  if (block->millimeters <= 0.0f) return false;
+
+  for (int i = 0; i < 3; i++) {
+    block->unitVec[i] = delta[i] / block->millimeters;
+  }
+
+  // Step event rates at which the slowest moving axis reaches its own
+  // start and cruise limits (an axis steps steps[i] / stepEventCount as often)
+  float maxRate = 1e30f;
+  block->startRate = 1e30f;
+  for (int i = 0; i < 3; i++) {
+    if (block->steps[i] == 0) continue;
+    float share = (float)block->stepEventCount / block->steps[i];
+    maxRate = min(maxRate, 1000000.0f / axisCruiseDelayUs[i] * share);
+    block->startRate = min(block->startRate, 1000000.0f / axisStartDelayUs[i] * share);
+  }
+  block->startRate = min(block->startRate, maxRate);
+
+  // Cruise speed: the feed, within the fastest speed at which no axis
+  // exceeds its step rate
+  block->maxSpeed = maxRate * block->millimeters / block->stepEventCount;
+  block->programmedSpeed = feedMmS;
+  block->nominalSpeed = plannerNominalSpeed(block);
+  block->acceleration = ACCELERATION_MM_S2;
+
+  // Junction speed with the previous move (grbl junction deviation)
+  block->maxJunctionSpeed = 0.0f;
+  if (plannerHasPrev && !plannerIsEmpty()) {
+    float cosTheta = -(plannerPrevUnitVec[0] * block->unitVec[0] +
+                       plannerPrevUnitVec[1] * block->unitVec[1] +
+                       plannerPrevUnitVec[2] * block->unitVec[2]);
+
+    if (cosTheta < -0.999999f) {
+      // Straight continuation
+      block->maxJunctionSpeed = 1e30f;
+    } else if (cosTheta < 0.999999f) {
+      float sinThetaD2 = sqrtf(0.5f * (1.0f - cosTheta));
+      float vSquared = block->acceleration * JUNCTION_DEVIATION_MM * sinThetaD2 / (1.0f - sinThetaD2);
+      block->maxJunctionSpeed = sqrtf(vSquared);
+    }
+    // else: full reversal, stop at the junction
+  }
+  block->maxEntrySpeed = min(block->maxJunctionSpeed, min(block->nominalSpeed, plannerPrevNominalSpeed));
+  block->entrySpeed = 0.0f;
+
+  for (int i = 0; i < 3; i++) {
+    plannerPrevUnitVec[i] = block->unitVec[i];
+  }
+  plannerPrevNominalSpeed = block->nominalSpeed;
+  plannerHasPrev = true;
+
+  plannerHead = plannerNextIndex(plannerHead);
+  plannerRecalculate();
+  METRICS_STOP(planTimer, planStart);
+  return true;
+}
+
+/**
+ * Set the feed override
+ * @return false if percent is out of range
+ */
+bool setFeedOverride(int percent) {
+  if (percent < FEED_OVERRIDE_MIN || percent > FEED_OVERRIDE_MAX) return false;
+  feedOverridePercent = percent;
+  feedOverrideChanged = true;
+  return true;
+}
+
+/**
+ * Re-plan the queued moves at the current feed override (motion task
+ * only). The running move picks up its new cruise speed from the next
+ * segment on.
+ */
+void plannerApplyFeedOverride() {
+  if (plannerIsEmpty()) return;
+
+  float prevNominal = 0.0f;
+  for (uint8_t index = plannerTail; index != plannerHead; index = plannerNextIndex(index)) {
+    PlannerBlock* block = &plannerBuffer[index];
+    block->nominalSpeed = plannerNominalSpeed(block);
+    if (index != plannerTail) {
+      block->maxEntrySpeed = min(block->maxJunctionSpeed, min(block->nominalSpeed, prevNominal));
+    }
+    prevNominal = block->nominalSpeed;
+  }
+  plannerPrevNominalSpeed = prevNominal;
+  plannerRecalculate();
+}
+
+/**
+ * Oldest queued block, or NULL if nothing is queued
+ */
+PlannerBlock* plannerCurrentBlock() {
+  if (plannerIsEmpty()) return NULL;
+  return &plannerBuffer[plannerTail];
+}
+
+/**
+ * Drop the oldest block once it has been executed
+ */
+void plannerDiscardCurrentBlock() {
+  if (!plannerIsEmpty()) {
+    plannerTail = plannerNextIndex(plannerTail);
+  }
+  if (plannerIsEmpty()) {
+    plannerHasPrev = false;
+  }
+}
+
+/**
+ * Drop every queued block (only while the step engine is stopped)
+ */
+void plannerReset() {
+  plannerTail = plannerHead;
+  plannerHasPrev = false;
+}
+
+#endif // PLANNER_H
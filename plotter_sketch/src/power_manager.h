@@ -0,0 +1,67 @@
+#ifndef POWER_MANAGER_H
+#define POWER_MANAGER_H
+
+#include <Arduino.h>
+#include "motor_control.h"
+#include "stepper.h"
+
+/**
+ * When an axis' coils may be switched off. A released axis keeps its
+ * phase and is energized at that phase again before its next step, so
+ * releasing it costs no position (the 28BYJ-48 gearbox holds the load).
+ */
+enum HoldPolicy {
+  HOLD_ALWAYS,          // Energized from its first step until M18/M84
+  HOLD_UNTIL_IDLE,      // Released once the plotter is idle (see powerManagerUpdate())
+  HOLD_WHILE_MOVING     // Also released mid-job once the axis has been still for axisReleaseMs
+};
+
+// Per-axis policy (X, Y, Z). HOLD_WHILE_MOVING on X/Y frees them while
+// only the pen moves. Z stays powered through a job, and whenever the pen
+// is down: the pen spring pushes back on it, and a pen that creeps
+// mid-stroke changes the line.
+HoldPolicy holdPolicy[3] = {HOLD_WHILE_MOVING, HOLD_WHILE_MOVING, HOLD_UNTIL_IDLE};
+
+// Release timeouts (milliseconds)
+int idleReleaseMs = 2000;
+int axisReleaseMs = 250;
+
+// Last position seen per axis and when it last changed
+int32_t powerLastPosition[3] = {0, 0, 0};
+uint32_t powerLastMoveMs[3] = {0, 0, 0};
+uint32_t powerLastBusyMs = 0;
+
+// Set by the motion task while a job (running, paused or queued), a
+// /gcode stream or a calibration has the plotter, however long it sits
+// between moves
+volatile bool powerPlotterBusy = false;
+
+/**
+ * Release axes their policy no longer needs powered. Cheap enough to call
+ * on every pass of the motion task. The plotter is idle once the motors
+ * have been still for idleReleaseMs with no job, stream, calibration or
+ * feed hold in progress; even then Z holds a lowered pen.
+ */
+void powerManagerUpdate() {
+  uint32_t now = millis();
+  if (stepperBusy() || powerPlotterBusy || stepperHold) powerLastBusyMs = now;
+  bool idle = now - powerLastBusyMs >= (uint32_t)idleReleaseMs;
+
+  for (int axis = 0; axis < 3; axis++) {
+    int32_t position = axisPosition[axis];
+    if (position != powerLastPosition[axis]) {
+      powerLastPosition[axis] = position;
+      powerLastMoveMs[axis] = now;
+      continue;
+    }
+    if (!axisEnergized[axis] || holdPolicy[axis] == HOLD_ALWAYS) continue;
+
+    bool still = now - powerLastMoveMs[axis] >= (uint32_t)axisReleaseMs;
+    bool holdsPen = axis == AXIS_Z && penState == PEN_LOWERED;
+    if ((idle && !holdsPen) || (holdPolicy[axis] == HOLD_WHILE_MOVING && still && !stepperAxisPending(axis))) {
+      releaseAxis(axis);
+    }
+  }
+}
+
+#endif // POWER_MANAGER_H
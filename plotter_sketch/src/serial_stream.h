@@ -0,0 +1,328 @@
+#ifndef SERIAL_STREAM_H
+#define SERIAL_STREAM_H
+
+#include <Arduino.h>
+#include "motor_control.h"
+#include "planner.h"
+#include "stepper.h"
+#include "motion.h"
+#include "gcode_parser.h"
+#include "gcode_stream.h"
+#include "calibration.h"
+#include "job_queue.h"
+
+/*
+ * G-code streaming over USB Serial, in the grbl 1.1 protocol, so standard
+ * host senders can drive the plotter without WiFi:
+ *
+ * - Every line is answered with "ok" or "error:N" once it has been
+ *   executed (its moves queued in the planner).
+ * - Senders use character counting: they keep at most
+ *   SERIAL_RX_BUFFER_SIZE bytes of unanswered lines in flight, which the
+ *   receive buffer below always has room for.
+ * - "?" (status report), "!" (feed hold), "~" (resume) and Ctrl-X (reset)
+ *   are acted on as soon as they arrive, wherever they fall in the stream.
+ *
+ * Bytes are taken from the UART as they arrive (Serial.onReceive()). That
+ * callback runs in the UART driver's event task, which has a small stack,
+ * so it only buffers line bytes and flags realtime commands; the motion
+ * task executes the lines and acts on the flags, including from its waits
+ * inside a move (motionWaitHook). Log messages still go to Serial;
+ * senders show them in their console. The per-line echo of G-code is off
+ * for serial lines.
+ */
+
+#define SERIAL_RX_BUFFER_SIZE 128       // grbl's RX_BUFFER_SIZE, which senders count against
+#define SERIAL_GRBL_BANNER "Grbl 1.1h ['$' for help]"
+#define SERIAL_GRBL_VERSION "[VER:1.1h.PlotterBot:]"
+
+// Realtime commands
+#define SERIAL_CMD_STATUS '?'
+#define SERIAL_CMD_HOLD '!'
+#define SERIAL_CMD_RESUME '~'
+#define SERIAL_CMD_RESET 0x18           // Ctrl-X
+
+#define SERIAL_LINE_TRUNCATED '\x01'     // Stored before the '\n' of a line cut short
+
+// grbl error codes used in "error:N" replies
+#define SERIAL_ERROR_BAD_SYSTEM_COMMAND 3
+#define SERIAL_ERROR_LOCKED 9           // A job or calibration has the plotter
+#define SERIAL_ERROR_LINE_TOO_LONG 11
+#define SERIAL_ERROR_INVALID_GCODE 20
+
+// Received line bytes. The UART side writes serialRxHead, the motion task
+// serialRxTail; both count bytes since boot, so head - tail is the fill.
+char serialRxBuffer[SERIAL_RX_BUFFER_SIZE];
+volatile uint32_t serialRxHead = 0;
+volatile uint32_t serialRxTail = 0;
+
+// Complete lines received and taken, same split
+volatile uint32_t serialLinesReceived = 0;
+uint32_t serialLinesTaken = 0;
+
+// Line being received: bytes stored so far, and whether some were
+// dropped (the line is then marked with SERIAL_LINE_TRUNCATED). Capping a
+// line below the buffer size means a full buffer always holds a complete
+// line for the motion task to free.
+size_t serialLineLength = 0;
+bool serialLineTruncated = false;
+
+// Bytes dropped because a sender overran the buffer
+volatile uint32_t serialRxOverflows = 0;
+
+// Realtime commands waiting for the motion task, set by the UART side
+volatile bool serialStatusRequested = false;
+volatile bool serialHoldRequested = false;
+volatile bool serialResumeRequested = false;
+
+volatile bool serialResetRequested = false;
+
+// Set by the motion task once it has acted on a Ctrl-X, cleared when the
+// motors are at rest and the reset is complete
+bool serialResetPending = false;
+
+/**
+ * Write one reply line in a single call, so it is never split by output
+ * from the other core
+ */
+void serialReply(const String& line) {
+  Serial.print(line + "\r\n");
+}
+
+/**
+ * Answer "?": machine state, position (mm), free planner blocks and
+ * receive buffer bytes, feed (mm/min) and overrides
+ */
+void serialStatusReport() {
+  int32_t steps[3];
+  portENTER_CRITICAL(&positionMux);
+  for (int i = 0; i < 3; i++) {
+    steps[i] = axisPosition[i];
+  }
+  portEXIT_CRITICAL(&positionMux);
+
+  bool running = jobActive() || calibrationActive || motionBusy || stepperBusy();
+  const char* state = "Idle";
+  if (stepperHold) {
+    state = stepperHoldComplete() ? "Hold:0" : "Hold:1";
+  } else if (running) {
+    state = "Run";
+  }
+
+  int plannerUsed = (plannerHead - plannerTail + PLANNER_BUFFER_SIZE) % PLANNER_BUFFER_SIZE;
+  float feed = running ? drawFeedMmMin * feedOverridePercent / 100.0f : 0.0f;
+
+  String report = "<" + String(state);
+  report += "|MPos:" + String(stepsToMm(AXIS_X, steps[AXIS_X]), 3);
+  report += "," + String(stepsToMm(AXIS_Y, steps[AXIS_Y]), 3);
+  report += "," + String(stepsToMm(AXIS_Z, steps[AXIS_Z]), 3);
+  report += "|Bf:" + String(PLANNER_BUFFER_SIZE - 1 - plannerUsed);
+  report += "," + String(SERIAL_RX_BUFFER_SIZE - (int)(serialRxHead - serialRxTail));
+  report += "|FS:" + String((int)feed) + ",0";
+  report += "|Ov:" + String(feedOverridePercent) + ",100,100>";
+  serialReply(report);
+}
+
+/**
+ * Store one line byte for the motion task
+ * @return false if the buffer is full
+ */
+bool serialStreamStore(char c) {
+  if (serialRxHead - serialRxTail >= SERIAL_RX_BUFFER_SIZE) {
+    serialRxOverflows++;
+    return false;
+  }
+  serialRxBuffer[serialRxHead % SERIAL_RX_BUFFER_SIZE] = c;
+  __sync_synchronize();
+  serialRxHead++;
+  return true;
+}
+
+/**
+ * Take the bytes waiting in the UART: realtime commands are flagged for
+ * the motion task, everything else is buffered. Runs in the UART event
+ * task, so it does nothing more.
+ */
+void serialStreamReceive() {
+  while (Serial.available() > 0) {
+    int c = Serial.read();
+
+    if (c == SERIAL_CMD_STATUS) {
+      serialStatusRequested = true;
+    } else if (c == SERIAL_CMD_HOLD) {
+      serialResumeRequested = false;
+      serialHoldRequested = true;
+    } else if (c == SERIAL_CMD_RESUME) {
+      serialHoldRequested = false;
+      serialResumeRequested = true;
+    } else if (c == SERIAL_CMD_RESET) {
+      serialLineLength = 0;
+      serialLineTruncated = false;
+      serialResetRequested = true;
+    } else if (c == '\n') {
+      if (serialLineTruncated) serialStreamStore(SERIAL_LINE_TRUNCATED);
+      serialLineLength = 0;
+      serialLineTruncated = false;
+      if (serialStreamStore('\n')) serialLinesReceived++;
+    } else if (c < ' ' && c != '\t') {
+      continue;  // '\r' and other control characters
+    } else if (c > 0x7F) {
+      continue;
+    } else if (serialLineLength >= GCODE_LINE_MAX - 2 || !serialStreamStore((char)c)) {
+      serialLineTruncated = true;
+    } else {
+      serialLineLength++;
+    }
+  }
+}
+
+/**
+ * Act on the realtime commands flagged since the last call (motion task
+ * only). Called from the motion task loop and from motionWait(), so a
+ * hold or reset also lands in the middle of a long move.
+ */
+void serialStreamRealtime() {
+  if (serialStatusRequested) {
+    serialStatusRequested = false;
+    serialStatusReport();
+  }
+  if (serialHoldRequested) {
+    serialHoldRequested = false;
+    // A dry run has no motors to hold, and its waits would spin on the
+    // hold instead of stepping the virtual clock
+    bool dryRun = dryRunActive || (jobActive() && activeJob->dryRun);
+    if (!dryRun) {
+      // A job pauses the same way as from the web interface
+      if (jobActive()) pauseJob(activeJob->id);
+      stepperHold = true;
+    }
+  }
+  if (serialResumeRequested) {
+    serialResumeRequested = false;
+    if (jobActive()) resumeJob(activeJob->id);
+    stepperHold = false;
+  }
+  if (serialResetRequested) {
+    serialResetRequested = false;
+    serialResetPending = true;
+    // Stop everything, as /api/stop does; serialStreamExecuteNext()
+    // finishes the reset once the current command has unwound
+    plotterStop();
+  }
+}
+
+/**
+ * Move the oldest complete line out of the buffer, freeing its bytes
+ * @return false if the line was too long (it is truncated)
+ */
+bool serialStreamTakeLine(char* line) {
+  size_t length = 0;
+  bool fits = true;
+  for (;;) {
+    char c = serialRxBuffer[serialRxTail % SERIAL_RX_BUFFER_SIZE];
+    serialRxTail++;
+    if (c == '\n') break;
+    if (c == SERIAL_LINE_TRUNCATED || length >= GCODE_LINE_MAX - 1) {
+      fits = false;
+    } else {
+      line[length++] = c;
+    }
+  }
+  line[length] = '\0';
+  serialLinesTaken++;
+  return fits;
+}
+
+/**
+ * True while a job, a calibration or a /gcode stream has the plotter:
+ * serial moves would interleave with it
+ */
+bool serialStreamLocked() {
+  return jobActive() || calibrationActive || calibrationPending || gcodeStreamActive();
+}
+
+/**
+ * Answer a grbl "$" system command
+ * @return 0 for "ok", else a grbl error code
+ */
+int serialSystemCommand(const char* line) {
+  if (strcmp(line, "$I") == 0) {
+    serialReply(SERIAL_GRBL_VERSION);
+    serialReply("[OPT:," + String(PLANNER_BUFFER_SIZE - 1) + "," + String(SERIAL_RX_BUFFER_SIZE) + "]");
+    return 0;
+  }
+  if (strcmp(line, "$G") == 0) {
+    String modes = "[GC:G0 G54 G17 G21 G90 G94 ";
+    modes += penState == PEN_LOWERED ? "M3" : "M5";
+    modes += " M9 T0 F" + String((int)drawFeedMmMin) + " S0]";
+    serialReply(modes);
+    return 0;
+  }
+  if (strcmp(line, "$H") == 0) {
+    if (serialStreamLocked()) return SERIAL_ERROR_LOCKED;
+    return executeGCode("G28") ? 0 : SERIAL_ERROR_INVALID_GCODE;
+  }
+  // No grbl settings to list, and no alarm state to unlock
+  if (strcmp(line, "$$") == 0 || strcmp(line, "$X") == 0 || strcmp(line, "$") == 0) {
+    return 0;
+  }
+  return SERIAL_ERROR_BAD_SYSTEM_COMMAND;
+}
+
+/**
+ * Execute one line received over Serial
+ * @return 0 for "ok", else a grbl error code
+ */
+int serialStreamExecute(const char* line, bool fits) {
+  if (!fits) return SERIAL_ERROR_LINE_TOO_LONG;
+  if (line[0] == '$') return serialSystemCommand(line);
+  if (line[0] != '\0' && serialStreamLocked()) return SERIAL_ERROR_LOCKED;
+
+  gcodeEcho = false;
+  bool ok = executeGCode(line);
+  gcodeEcho = true;
+  return ok ? 0 : SERIAL_ERROR_INVALID_GCODE;
+}
+
+/**
+ * Execute the oldest line received over Serial and answer it (motion
+ * task only). Also carries out a Ctrl-X reset.
+ * @return false if no line was waiting
+ */
+bool serialStreamExecuteNext() {
+  if (serialResetPending) {
+    // Lines sent before the reset are dropped unanswered, as in grbl
+    serialRxTail = serialRxHead;
+    serialLinesTaken = serialLinesReceived;
+    simplifyDiscard();
+    motionStopAndFlush();
+    motionAbortRequested = false;
+    serialResetPending = false;
+    serialReply("");
+    serialReply(SERIAL_GRBL_BANNER);
+    return true;
+  }
+  if (serialLinesReceived == serialLinesTaken) return false;
+
+  char line[GCODE_LINE_MAX];
+  bool fits = serialStreamTakeLine(line);
+  motionBusy = true;
+  int error = serialStreamExecute(line, fits);
+  serialStreamRealtime();
+  if (serialResetPending) return true;
+
+  serialReply(error == 0 ? String("ok") : "error:" + String(error));
+  return true;
+}
+
+/**
+ * Start taking G-code over Serial, and announce the protocol to senders
+ */
+void serialStreamBegin() {
+  motionWaitHook = serialStreamRealtime;
+  Serial.onReceive(serialStreamReceive);
+  serialReply("");
+  serialReply(SERIAL_GRBL_BANNER);
+}
+
+#endif // SERIAL_STREAM_H
@@ -0,0 +1,313 @@
+#ifndef STEPPER_H
+#define STEPPER_H
+
+#include <Arduino.h>
+#include "motor_control.h"
+#include "planner.h"
+#include "dry_run.h"
+#include "metrics.h"
+#include "trace.h"
+
+// Step engine settings
+#define SEGMENT_BUFFER_SIZE 16          // Prepared segments queued for the ISR
+#define SEGMENT_DURATION_US 10000       // Target length of one segment
+#define STEP_TIMER_PRESCALER 80         // 80 MHz APB / 80 = 1 tick per microsecond
+
+/**
+ * Bresenham data of a planner block, copied so the ISR keeps it after the
+ * planner has discarded the block
+ */
+struct StepperBlock {
+  long steps[3];
+  int8_t dir[3];            // Half steps per step event, signed (+-1 or +-2)
+  long stepEventCount;
+};
+
+/**
+ * A run of step events at one constant step period
+ */
+struct StepSegment {
+  uint16_t nSteps;          // Step events in this segment
+  uint32_t periodUs;        // Time between step events
+  uint8_t blockIndex;       // Index into stepperBlocks
+  bool firstOfBlock;        // Reset Bresenham counters before this segment
+};
+
+// Single-producer / single-consumer queue: stepperPrepBuffer() only writes
+// segmentHead, the step ISR only writes segmentTail.
+StepSegment segmentBuffer[SEGMENT_BUFFER_SIZE];
+volatile uint8_t segmentHead = 0;
+volatile uint8_t segmentTail = 0;
+
+// One slot per block that still has segments queued
+StepperBlock stepperBlocks[SEGMENT_BUFFER_SIZE];
+
+hw_timer_t* stepTimer = NULL;
+volatile bool stepperRunning = false;
+
+// Step events output since boot (for job progress)
+volatile uint32_t stepEventCount = 0;
+
+// Feed hold: decelerate to a stop at the end of the running block and
+// start no further blocks until cleared
+volatile bool stepperHold = false;
+
+// ISR state
+StepperBlock* isrBlock = NULL;
+long isrError[3];
+uint16_t isrStepsLeft = 0;
+
+#if PLOTTER_METRICS
+// Step tick jitter: when the last tick fired and how long until the next
+// one should (0 = unknown, right after the timer starts)
+uint32_t isrLastTickCycles = 0;
+uint32_t isrExpectedCycles = 0;
+#endif
+
+// Segment preparation state (main context)
+PlannerBlock* prepBlock = NULL;
+uint8_t prepBlockIndex = 0;
+long prepStepsDone = 0;
+float prepSpeed = 0.0f;          // Speed at the end of the last prepared segment (mm/s)
+
+// Position each axis reaches once every prepared segment is stepped out
+int32_t prepPosition[3] = {0, 0, 0};
+
+uint8_t segmentNextIndex(uint8_t index) {
+  return (index + 1) % SEGMENT_BUFFER_SIZE;
+}
+
+bool segmentBufferEmpty() {
+  return segmentHead == segmentTail;
+}
+
+bool segmentBufferFull() {
+  return segmentNextIndex(segmentHead) == segmentTail;
+}
+
+/**
+ * Step timer interrupt: one step event per call
+ */
+void IRAM_ATTR onStepTimer() {
+#if PLOTTER_METRICS
+  uint32_t tickStart = metricsCycles();
+  if (isrExpectedCycles != 0) {
+    int32_t error = (int32_t)(tickStart - isrLastTickCycles - isrExpectedCycles);
+    metricsRecord(&stepJitterTimer, error < 0 ? -error : error);
+  }
+  isrLastTickCycles = tickStart;
+#endif
+
+  if (isrStepsLeft == 0) {
+    if (segmentBufferEmpty()) {
+      // Nothing prepared: go idle until stepperWake(). With moves still
+      // queued (and no hold) the motion task fell behind: an underrun.
+      TRACE_RECORD(!stepperHold && (prepBlock != NULL || plannerHead != plannerTail) ? TRACE_UNDERRUN : TRACE_IDLE, 0, 0);
+      timerAlarmDisable(stepTimer);
+      stepperRunning = false;
+#if PLOTTER_METRICS
+      isrExpectedCycles = 0;
+#endif
+      return;
+    }
+
+    StepSegment* segment = &segmentBuffer[segmentTail];
+    if (segment->firstOfBlock || isrBlock == NULL) {
+      isrBlock = &stepperBlocks[segment->blockIndex];
+      for (int i = 0; i < 3; i++) {
+        isrError[i] = isrBlock->stepEventCount / 2;
+      }
+    }
+    isrStepsLeft = segment->nSteps;
+    timerAlarmWrite(stepTimer, segment->periodUs, true);
+    TRACE_RECORD(TRACE_SEGMENT, segment->firstOfBlock, min(segment->periodUs, (uint32_t)UINT16_MAX));
+#if PLOTTER_METRICS
+    isrExpectedCycles = segment->periodUs * metricsCyclesPerUs;
+#endif
+  }
+
+  // Bresenham step event across X, Y and Z, then one coil update
+  uint8_t stepped = 0;
+  portENTER_CRITICAL_ISR(&positionMux);
+  for (int i = 0; i < 3; i++) {
+    isrError[i] -= isrBlock->steps[i];
+    if (isrError[i] < 0) {
+      isrError[i] += isrBlock->stepEventCount;
+      advancePhase(i, isrBlock->dir[i]);
+      stepped |= 1 << i;
+    }
+  }
+  portEXIT_CRITICAL_ISR(&positionMux);
+  writeCoils();
+  stepEventCount++;
+  TRACE_RECORD(TRACE_STEP, stepped, axisPhase[AXIS_X] | axisPhase[AXIS_Y] << 3 | axisPhase[AXIS_Z] << 6);
+
+  isrStepsLeft--;
+  if (isrStepsLeft == 0) {
+    segmentTail = segmentNextIndex(segmentTail);
+  }
+  METRICS_STOP(stepIsrTimer, tickStart);
+}
+
+/**
+ * Set up the step timer (idle until the first segment is queued)
+ */
+void stepperInit() {
+  stepTimer = timerBegin(0, STEP_TIMER_PRESCALER, true);
+  timerAttachInterrupt(stepTimer, &onStepTimer, true);
+  timerAlarmWrite(stepTimer, slowestStartDelayUs(), true);
+}
+
+/**
+ * Start the step timer if segments are waiting and it is idle
+ */
+void stepperWake() {
+  if (dryRunActive) {
+    // No timer: stepperDryRunConsume() plays the ISR's part
+    stepperRunning = !segmentBufferEmpty();
+    return;
+  }
+  if (!stepperRunning && !segmentBufferEmpty()) {
+    stepperRunning = true;
+    timerWrite(stepTimer, 0);
+    timerAlarmWrite(stepTimer, slowestStartDelayUs(), true);
+    timerAlarmEnable(stepTimer);
+  }
+}
+
+/**
+ * Turn planner blocks into step segments until the segment buffer is full.
+ * Each segment runs at the speed of the trapezoid at its midpoint, never
+ * below the block's start rate (or its cruise speed, if that is lower).
+ */
+void stepperPrepBuffer() {
+  METRICS_START(prepStart);
+  if (feedOverrideChanged) {
+    feedOverrideChanged = false;
+    plannerApplyFeedOverride();
+  }
+
+  while (!segmentBufferFull()) {
+    if (prepBlock == NULL) {
+      if (stepperHold) {
+        // The motors are stopped by the time the hold is released
+        prepSpeed = 0.0f;
+        break;
+      }
+      prepBlock = plannerCurrentBlock();
+      if (prepBlock == NULL) break;
+
+      prepBlockIndex = segmentNextIndex(prepBlockIndex);
+      StepperBlock* stepperBlock = &stepperBlocks[prepBlockIndex];
+      for (int i = 0; i < 3; i++) {
+        stepperBlock->steps[i] = prepBlock->steps[i];
+        stepperBlock->dir[i] = prepBlock->dir[i] * prepBlock->stepSize;
+      }
+      stepperBlock->stepEventCount = prepBlock->stepEventCount;
+      prepStepsDone = 0;
+
+      // A released axis is held at its phase again before it steps
+      for (int i = 0; i < 3 && !dryRunActive; i++) {
+        prepPosition[i] += prepBlock->dir[i] * prepBlock->stepSize * prepBlock->steps[i];
+        if (prepBlock->steps[i] > 0 && !axisEnergized[i]) {
+          energizeAxis(i);
+        }
+      }
+    }
+
+    // Exit speed is re-read every segment: lookahead may raise it while
+    // this block is still running, and a hold drops it to zero
+    float exitSpeed = stepperHold ? 0.0f : plannerExitSpeed(plannerTail);
+    float stepsPerMm = prepBlock->stepEventCount / prepBlock->millimeters;
+    float twoA = 2.0f * prepBlock->acceleration;
+    // Never slower than the start rate, unless the feed itself is slower
+    float minRate = min(prepBlock->startRate, prepBlock->nominalSpeed * stepsPerMm);
+
+    long stepsLeft = prepBlock->stepEventCount - prepStepsDone;
+    float rate = max(prepSpeed * stepsPerMm, minRate);
+    long nSteps = (long)(rate * SEGMENT_DURATION_US / 1000000.0f);
+    nSteps = constrain(nSteps, 1L, min(stepsLeft, 65535L));
+
+    // Speed at the middle and the end of the segment: accelerate from the
+    // previous segment towards cruise (or slow down to it, if the feed
+    // override was lowered), and decelerate towards the exit speed
+    float halfMm = nSteps / (2.0f * stepsPerMm);
+    float remainingMid = (stepsLeft - nSteps / 2.0f) / stepsPerMm;
+    float remainingEnd = (stepsLeft - nSteps) / stepsPerMm;
+    float prepSq = prepSpeed * prepSpeed;
+    float exitSq = exitSpeed * exitSpeed;
+    float cruise = prepBlock->nominalSpeed;
+
+    float midSpeed, endSpeed;
+    if (prepSpeed > cruise) {
+      midSpeed = max(cruise, sqrtf(max(0.0f, prepSq - twoA * halfMm)));
+      endSpeed = max(cruise, sqrtf(max(0.0f, prepSq - twoA * 2.0f * halfMm)));
+    } else {
+      midSpeed = min(cruise, sqrtf(prepSq + twoA * halfMm));
+      endSpeed = min(cruise, sqrtf(prepSq + twoA * 2.0f * halfMm));
+    }
+    midSpeed = min(midSpeed, sqrtf(exitSq + twoA * remainingMid));
+    prepSpeed = min(endSpeed, sqrtf(exitSq + twoA * remainingEnd));
+
+    StepSegment* segment = &segmentBuffer[segmentHead];
+    segment->nSteps = nSteps;
+    segment->periodUs = (uint32_t)(1000000.0f / max(midSpeed * stepsPerMm, minRate));
+    segment->blockIndex = prepBlockIndex;
+    segment->firstOfBlock = (prepStepsDone == 0);
+
+    // Publish the segment before releasing the planner block, so
+    // stepperBusy() never sees both empty while steps remain
+    segmentHead = segmentNextIndex(segmentHead);
+
+    prepStepsDone += nSteps;
+    if (prepStepsDone >= prepBlock->stepEventCount) {
+      plannerDiscardCurrentBlock();
+      prepBlock = NULL;
+    }
+  }
+
+  stepperWake();
+  METRICS_STOP(segmentPrepTimer, prepStart);
+}
+
+/**
+ * Dry-run stand-in for the step ISR: retire the oldest prepared segment
+ * and advance the virtual clock by the time it would take to step out
+ */
+void stepperDryRunConsume() {
+  if (!segmentBufferEmpty()) {
+    StepSegment* segment = &segmentBuffer[segmentTail];
+    if (segment->firstOfBlock) {
+      StepperBlock* block = &stepperBlocks[segment->blockIndex];
+      for (int i = 0; i < 3; i++) {
+        dryRunReport.steps[i] += block->steps[i] * abs(block->dir[i]);
+      }
+    }
+    dryRunAddTime((uint32_t)segment->nSteps * segment->periodUs);
+    segmentTail = segmentNextIndex(segmentTail);
+  }
+  stepperRunning = !segmentBufferEmpty();
+}
+
+/**
+ * True once a hold has brought the motors to rest at a block boundary
+ */
+bool stepperHoldComplete() {
+  return stepperHold && prepBlock == NULL && segmentBufferEmpty() && !stepperRunning;
+}
+
+/**
+ * True if prepared segments still hold steps for an axis
+ */
+bool stepperAxisPending(int axis) {
+  return axisPosition[axis] != prepPosition[axis];
+}
+
+/**
+ * True while anything is queued or moving
+ */
+bool stepperBusy() {
+  return prepBlock != NULL || !plannerIsEmpty() || !segmentBufferEmpty() || stepperRunning;
+}
+
+#endif // STEPPER_H
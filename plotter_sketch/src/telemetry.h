@@ -0,0 +1,128 @@
+#ifndef TELEMETRY_H
+#define TELEMETRY_H
+
+#include <Arduino.h>
+#include <WebSocketsServer.h>
+#include "motion_task.h"
+#include "job_queue.h"
+
+// Telemetry settings
+#define TELEMETRY_PORT 81
+#define TELEMETRY_FRAME_SIZE 160        // Longest frame is about 110 bytes
+#define TELEMETRY_MIN_HZ 1
+#define TELEMETRY_MAX_HZ 50
+#define TELEMETRY_KEEPALIVE_MS 1000     // Unchanged frames are resent this often
+
+/*
+ * Telemetry frame, one JSON text message per push:
+ *   {"s":"plotting","x":12.34,"y":56.78,"z":0.00,"q":1,
+ *    "j":3,"js":"running","p":42,"n":1234}
+ *   s   Plotter state (as in /status)
+ *   x,y,z  Position the motors have reached, mm
+ *   q   Jobs waiting to run
+ *   j,js,p,n  Active job ID, state, percent and lines done; omitted when
+ *             no job is running
+ *
+ * A client may send the text message "stop" to do what /api/stop does.
+ * It is read even while a /gcode upload holds the HTTP server waiting for
+ * line buffer space.
+ */
+
+// Pushes per second to every connected client
+int telemetryHz = 10;
+
+WebSocketsServer telemetryServer(TELEMETRY_PORT);
+
+char telemetryFrame[TELEMETRY_FRAME_SIZE];
+char telemetryLastFrame[TELEMETRY_FRAME_SIZE];
+size_t telemetryLastLength = 0;
+unsigned long telemetryLastPushMs = 0;
+unsigned long telemetryLastSendMs = 0;
+
+/**
+ * Build the current frame into telemetryFrame (no allocation)
+ * @return Frame length
+ */
+size_t telemetryBuildFrame() {
+  PlotterStatus status = getPlotterStatus();
+
+  int length = snprintf(telemetryFrame, TELEMETRY_FRAME_SIZE,
+                        "{\"s\":\"%s\",\"x\":%.2f,\"y\":%.2f,\"z\":%.2f,\"q\":%d",
+                        plotterStateName(status.state), status.x, status.y, status.z,
+                        jobsQueuedCount());
+
+  Job* job = activeJob;
+  if (job != NULL && length < TELEMETRY_FRAME_SIZE) {
+    length += snprintf(telemetryFrame + length, TELEMETRY_FRAME_SIZE - length,
+                       ",\"j\":%lu,\"js\":\"%s\",\"p\":%d,\"n\":%d",
+                       (unsigned long)job->id, jobStateName(job->state),
+                       jobPercent(job), job->linesDone);
+  }
+
+  if (length < TELEMETRY_FRAME_SIZE - 1) {
+    telemetryFrame[length++] = '}';
+    telemetryFrame[length] = '\0';
+  } else {
+    length = 0;
+  }
+  return length;
+}
+
+void telemetryEvent(uint8_t client, WStype_t type, uint8_t* payload, size_t length) {
+  if (type == WStype_CONNECTED) {
+    // New clients get the current frame right away
+    size_t frameLength = telemetryBuildFrame();
+    if (frameLength > 0) {
+      telemetryServer.sendTXT(client, telemetryFrame, frameLength);
+    }
+  } else if (type == WStype_TEXT && length == 4 && memcmp(payload, "stop", 4) == 0) {
+    Serial.println("Stop requested over telemetry");
+    plotterStop();
+  }
+}
+
+/**
+ * Start the WebSocket server (after WiFi is up)
+ */
+void telemetryBegin() {
+  telemetryServer.begin();
+  telemetryServer.onEvent(telemetryEvent);
+}
+
+/**
+ * Set the push rate
+ * @return false if hz is out of range
+ */
+bool setTelemetryHz(int hz) {
+  if (hz < TELEMETRY_MIN_HZ || hz > TELEMETRY_MAX_HZ) return false;
+  telemetryHz = hz;
+  return true;
+}
+
+/**
+ * Service the WebSocket server and push a frame when one is due. Frames
+ * that have not changed since the last push are only resent every
+ * TELEMETRY_KEEPALIVE_MS. Call from the network task.
+ */
+void telemetryLoop() {
+  telemetryServer.loop();
+
+  unsigned long now = millis();
+  if (now - telemetryLastPushMs < (unsigned long)(1000 / telemetryHz)) return;
+  telemetryLastPushMs = now;
+
+  if (telemetryServer.connectedClients() == 0) return;
+
+  size_t length = telemetryBuildFrame();
+  if (length == 0) return;
+
+  bool changed = length != telemetryLastLength || memcmp(telemetryFrame, telemetryLastFrame, length) != 0;
+  if (!changed && now - telemetryLastSendMs < TELEMETRY_KEEPALIVE_MS) return;
+
+  telemetryServer.broadcastTXT(telemetryFrame, length);
+  memcpy(telemetryLastFrame, telemetryFrame, length);
+  telemetryLastLength = length;
+  telemetryLastSendMs = now;
+}
+
+#endif // TELEMETRY_H
@@ -0,0 +1,175 @@
+#ifndef TRACE_H
+#define TRACE_H
+
+#include <Arduino.h>
+
+/*
+ * Step-timing trace: the step ISR logs one timestamped event per step
+ * tick, segment load and idle transition into a RAM ring buffer. A capture
+ * is started over HTTP, downloaded as a binary dump and decoded on the
+ * host with tools/trace_decode.py.
+ *
+ * The buffer is only allocated when a capture starts. platformio.ini
+ * compiles the recorder in with -D PLOTTER_TRACE=1; at 0 TRACE_RECORD
+ * expands to nothing and /api/trace answers 404.
+ *
+ * Events are only ever written by the step ISR, so recording takes no
+ * lock. A dump is only read while no capture is running.
+ */
+
+#ifndef PLOTTER_TRACE
+#define PLOTTER_TRACE 0
+#endif
+
+#define TRACE_VERSION 1
+#define TRACE_DEFAULT_EVENTS 4096       // 32 KB
+#define TRACE_MAX_EVENTS 16384          // 128 KB
+#define TRACE_POST_TRIGGER_DIVISOR 4    // "underrun" mode keeps a quarter of the buffer after the trigger
+
+enum TraceEventType {
+  TRACE_STEP = 1,       // arg: axes that stepped (bit 0 X, 1 Y, 2 Z); value: phases X | Y << 3 | Z << 6
+  TRACE_SEGMENT = 2,    // arg: 1 if the segment starts a block; value: step period (us, capped at 65535)
+  TRACE_UNDERRUN = 3,   // The segment buffer ran dry while moves were still queued
+  TRACE_IDLE = 4        // The segment buffer ran dry with nothing queued (or on a hold)
+};
+
+enum TraceMode {
+  TRACE_ONCE,           // Record until the buffer is full
+  TRACE_RING,           // Overwrite the oldest events until stopped
+  TRACE_UNDERRUN_STOP   // Like TRACE_RING, stopping a little after the first underrun
+};
+
+/**
+ * One recorded event (8 bytes, little-endian in the dump)
+ */
+struct TraceEvent {
+  uint32_t timeUs;
+  uint8_t type;
+  uint8_t arg;
+  uint16_t value;
+};
+
+/**
+ * Dump header, followed by eventCount events, oldest first
+ */
+struct TraceHeader {
+  char magic[4];            // "PTRC"
+  uint8_t version;
+  uint8_t eventSize;
+  uint16_t reserved;
+  uint32_t eventCount;
+  uint32_t lostEvents;      // Overwritten in ring modes
+};
+
+#if PLOTTER_TRACE
+
+#define TRACE_RECORD(type, arg, value) traceRecord(type, arg, value)
+
+TraceEvent* traceBuffer = NULL;
+uint32_t traceCapacity = 0;
+TraceMode traceMode = TRACE_ONCE;
+
+// Written by the ISR while armed
+volatile bool traceArmed = false;
+volatile uint32_t traceWritten = 0;     // Events recorded since the capture started
+volatile uint32_t traceHead = 0;        // Next slot to write
+volatile uint32_t traceStopAt = 0;      // Stop once traceWritten reaches this (0 = no limit)
+
+const char* traceModeName(TraceMode mode) {
+  switch (mode) {
+    case TRACE_RING: return "ring";
+    case TRACE_UNDERRUN_STOP: return "underrun";
+    default: return "once";
+  }
+}
+
+/**
+ * Record one event. Runs in the step ISR.
+ */
+void IRAM_ATTR traceRecord(uint8_t type, uint8_t arg, uint16_t value) {
+  if (!traceArmed) return;
+
+  TraceEvent* event = &traceBuffer[traceHead];
+  event->timeUs = micros();
+  event->type = type;
+  event->arg = arg;
+  event->value = value;
+
+  uint32_t head = traceHead + 1;
+  traceHead = head == traceCapacity ? 0 : head;
+  uint32_t written = traceWritten + 1;
+  traceWritten = written;
+
+  if (type == TRACE_UNDERRUN && traceMode == TRACE_UNDERRUN_STOP && traceStopAt == 0) {
+    traceStopAt = written + traceCapacity / TRACE_POST_TRIGGER_DIVISOR;
+  }
+  if ((traceMode == TRACE_ONCE && written == traceCapacity) || written == traceStopAt) {
+    traceArmed = false;
+  }
+}
+
+/**
+ * Stop recording, and wait out an event the ISR may be writing on the
+ * other core
+ */
+void traceStop() {
+  if (!traceArmed) return;
+  traceArmed = false;
+  vTaskDelay(1);
+}
+
+/**
+ * Start a capture, allocating (or reusing) a buffer of capacity events
+ * @return false if the buffer could not be allocated
+ */
+bool traceStart(TraceMode mode, uint32_t capacity) {
+  traceStop();
+  if (traceBuffer == NULL || capacity != traceCapacity) {
+    free(traceBuffer);
+    traceBuffer = (TraceEvent*)malloc(capacity * sizeof(TraceEvent));
+    traceCapacity = traceBuffer != NULL ? capacity : 0;
+    if (traceBuffer == NULL) return false;
+  }
+
+  traceMode = mode;
+  traceWritten = 0;
+  traceHead = 0;
+  traceStopAt = 0;
+  traceArmed = true;
+  return true;
+}
+
+/**
+ * Stop and free the buffer
+ */
+void traceClear() {
+  traceStop();
+  free(traceBuffer);
+  traceBuffer = NULL;
+  traceCapacity = 0;
+  traceWritten = 0;
+  traceHead = 0;
+}
+
+/**
+ * Events held in the buffer
+ */
+uint32_t traceEventCount() {
+  uint32_t written = traceWritten;
+  return written < traceCapacity ? written : traceCapacity;
+}
+
+/**
+ * Index of the oldest event held
+ */
+uint32_t traceOldestIndex() {
+  return traceWritten > traceCapacity ? traceHead : 0;
+}
+
+#else
+
+#define TRACE_RECORD(type, arg, value)
+
+#endif // PLOTTER_TRACE
+
+#endif // TRACE_H
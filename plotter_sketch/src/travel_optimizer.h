@@ -0,0 +1,643 @@
+#ifndef TRAVEL_OPTIMIZER_H
+#define TRAVEL_OPTIMIZER_H
+
+#include <Arduino.h>
+#include <LittleFS.h>
+#include "motor_control.h"
+#include "gcode_parser.h"
+#include "gcode_stream.h"
+
+// Travel optimizer settings
+#define TRAVEL_MAX_STROKES 2048         // Larger programs are plotted as sent
+#define TRAVEL_TIME_BUDGET_MS 3000      // 2-opt stops improving after this long
+#define TRAVEL_CHUNK 512                // Bytes read from flash at a time
+
+/**
+ * One pen-down stroke of a program: the byte range of its drawing lines in
+ * the spool file and the points where the pen goes down and comes up
+ */
+struct TravelStroke {
+  uint32_t begin;           // Offset of the first drawing line
+  uint32_t end;             // Offset just past the last drawing line
+  float startX, startY;     // Pen down
+  float endX, endY;         // Pen up
+  float feed;               // Feed of its drawing moves (mm/min, 0 = none set, -1 = no moves)
+  bool reversible;          // No arcs, one feed, and every G1 names both X and Y
+};
+
+/**
+ * A stroke in plotting order, optionally drawn end to start
+ */
+struct TravelStop {
+  uint16_t stroke;
+  bool reversed;
+};
+
+/**
+ * What became of a program. Only TRAVEL_REWRITTEN and TRAVEL_KEPT are
+ * final; after a failure the program may reorder on another attempt.
+ */
+enum TravelOutcome {
+  TRAVEL_REWRITTEN,         // Reordered and saved
+  TRAVEL_KEPT,              // No shorter order, or not safe to reorder
+  TRAVEL_NO_MEMORY,         // The stroke tables could not be allocated
+  TRAVEL_TOO_MANY_STROKES,  // More than TRAVEL_MAX_STROKES
+  TRAVEL_WRITE_FAILED       // The spool could not be read, or the rewrite did not fit in flash
+};
+
+/**
+ * Pen-up travel of a job before and after optimization
+ */
+struct TravelReport {
+  float beforeMm;
+  float afterMm;
+  int strokes;
+  TravelOutcome outcome;
+};
+
+const char* travelOutcomeName(TravelOutcome outcome) {
+  switch (outcome) {
+    case TRAVEL_REWRITTEN: return "rewritten";
+    case TRAVEL_KEPT: return "kept";
+    case TRAVEL_NO_MEMORY: return "out of memory";
+    case TRAVEL_TOO_MANY_STROKES: return "too many strokes";
+    default: return "flash read or write failed";
+  }
+}
+
+// Buffered line reader over a spool file that knows its byte offset
+struct TravelReader {
+  File* file;
+  uint8_t buffer[TRAVEL_CHUNK];
+  size_t length;
+  size_t pos;
+  uint32_t offset;          // File offset of the next unread byte
+};
+
+// Working state (motion task only)
+TravelReader travelReader;
+char travelChunk[TRAVEL_CHUNK];
+TravelStroke* travelStrokes = NULL;
+TravelStop* travelTour = NULL;
+int travelStrokeCount = 0;
+
+/**
+ * Read the next line and advance the offset past its terminator
+ * @return false at end of file
+ */
+bool travelReadLine(TravelReader* r, char* line, size_t maxLength, bool* tooLong) {
+  size_t length = 0;
+  bool any = false;
+  *tooLong = false;
+
+  while (true) {
+    if (r->pos >= r->length) {
+      r->length = r->file->read(r->buffer, TRAVEL_CHUNK);
+      r->pos = 0;
+      if (r->length == 0) break;
+    }
+
+    char c = (char)r->buffer[r->pos++];
+    r->offset++;
+    any = true;
+    if (c == '\n') break;
+    if (c == '\r') continue;
+    if (length < maxLength - 1) {
+      line[length++] = c;
+    } else {
+      *tooLong = true;
+    }
+  }
+
+  line[length] = '\0';
+  return any;
+}
+
+float travelDistance(float x1, float y1, float x2, float y2) {
+  float dx = x2 - x1;
+  float dy = y2 - y1;
+  return sqrtf(dx * dx + dy * dy);
+}
+
+// Where the pen goes down / comes up for a stop
+float travelEntryX(const TravelStop* stop) {
+  const TravelStroke* s = &travelStrokes[stop->stroke];
+  return stop->reversed ? s->endX : s->startX;
+}
+
+float travelEntryY(const TravelStop* stop) {
+  const TravelStroke* s = &travelStrokes[stop->stroke];
+  return stop->reversed ? s->endY : s->startY;
+}
+
+float travelExitX(const TravelStop* stop) {
+  const TravelStroke* s = &travelStrokes[stop->stroke];
+  return stop->reversed ? s->startX : s->endX;
+}
+
+float travelExitY(const TravelStop* stop) {
+  const TravelStroke* s = &travelStrokes[stop->stroke];
+  return stop->reversed ? s->startY : s->endY;
+}
+
+/**
+ * Sleep a tick now and then so long optimizations do not starve the core
+ */
+void travelYield(uint32_t* lastYield) {
+  if (millis() - *lastYield > 50) {
+    vTaskDelay(1);
+    *lastYield = millis();
+  }
+}
+
+/**
+ * Layout of a program found by travelScan()
+ */
+struct TravelLayout {
+  uint32_t prologueEnd;     // Setup lines before the first stroke
+  uint32_t epilogueBegin;   // First line after the strokes (G28, M18, ...)
+  float originX, originY;   // Position when the first travel starts
+  bool hasFinalTravel;      // A G0 after the last stroke
+  float finalX, finalY;
+  float travelMm;           // Pen-up travel in program order
+  bool hasFeed;             // Some drawing move has an F; each stroke then sets its own
+  bool tooManyStrokes;      // The scan stopped at TRAVEL_MAX_STROKES
+};
+
+/**
+ * Split a program into pen-down strokes. Only absolute G0/G1/G2/G3 XY
+ * moves and M3/M5 may appear between the first and last stroke; setup before and
+ * commands such as G28 or M18 after are kept in place. F is modal, so
+ * every stroke records the feed it starts at; a program that draws both
+ * with and without a feed is not reordered.
+ * @return false if the program cannot be reordered safely
+ */
+bool travelScan(File& file, uint32_t fileSize, TravelLayout* layout) {
+  TravelReader* r = &travelReader;
+  r->file = &file;
+  r->length = 0;
+  r->pos = 0;
+  r->offset = 0;
+
+  float x = currentX;
+  float y = currentY;
+  bool inBody = false;
+  bool inEpilogue = false;
+  bool penDown = false;
+  bool pendingTravel = false;
+  bool drewWithoutFeed = false;
+  float feed = 0.0f;              // Jobs start without a feed
+  TravelStroke* stroke = NULL;
+
+  layout->prologueEnd = 0;
+  layout->hasFeed = false;
+  layout->epilogueBegin = fileSize;
+  layout->hasFinalTravel = false;
+  layout->travelMm = 0;
+  layout->tooManyStrokes = false;
+  travelStrokeCount = 0;
+
+  char line[GCODE_LINE_MAX];
+  bool tooLong;
+  uint32_t lastYield = millis();
+
+  while (true) {
+    uint32_t lineStart = r->offset;
+    if (!travelReadLine(r, line, sizeof(line), &tooLong)) break;
+    if (tooLong) return false;
+    travelYield(&lastYield);
+
+    GCodeBlock block;
+    if (!parseGCodeLine(line, &block)) return false;
+    if (block.present == 0) continue;
+
+    bool isG = hasWord(&block, 'G');
+    bool isM = !isG && hasWord(&block, 'M');
+    int code = isG ? (int)wordValue(&block, 'G') : (isM ? (int)wordValue(&block, 'M') : -1);
+    bool isTravel = isG && code == 0;
+    bool isArc = isG && (code == 2 || code == 3);
+    bool isDraw = (isG && code == 1) || isArc;
+    bool isPenDown = isM && code == 3;
+    bool isPenUp = isM && code == 5;
+    bool isNeutral = (isG && code == 90) || (isM && code == 114);
+
+    if (hasWord(&block, 'Z') || (isG && code == 91)) return false;
+    if (hasWord(&block, 'F')) feed = wordValue(&block, 'F');
+
+    if (inEpilogue) {
+      if (isTravel || isDraw || isPenDown) return false;
+      continue;
+    }
+
+    if (!inBody) {
+      if (!(isTravel || isDraw || isPenDown || isPenUp)) {
+        if (isG && code == 28) {
+          x = 0;
+          y = 0;
+        }
+        continue;
+      }
+      inBody = true;
+      layout->prologueEnd = lineStart;
+      layout->originX = x;
+      layout->originY = y;
+    }
+
+    if (isNeutral) continue;
+    if (!(isTravel || isDraw || isPenDown || isPenUp)) {
+      inEpilogue = true;
+      layout->epilogueBegin = lineStart;
+      continue;
+    }
+
+    float nx = hasWord(&block, 'X') ? wordValue(&block, 'X') : x;
+    float ny = hasWord(&block, 'Y') ? wordValue(&block, 'Y') : y;
+
+    if (isTravel || isPenUp) {
+      penDown = false;
+      stroke = NULL;
+      if (isTravel) {
+        layout->travelMm += travelDistance(x, y, nx, ny);
+        x = nx;
+        y = ny;
+        pendingTravel = true;
+      }
+      continue;
+    }
+
+    // Pen goes down (M3) or draws (G1): open a stroke if none is open
+    if (!penDown) {
+      if (travelStrokeCount >= TRAVEL_MAX_STROKES) {
+        layout->tooManyStrokes = true;
+        return false;
+      }
+      stroke = &travelStrokes[travelStrokeCount++];
+      stroke->begin = isPenDown ? r->offset : lineStart;
+      stroke->end = stroke->begin;
+      stroke->startX = x;
+      stroke->startY = y;
+      stroke->endX = x;
+      stroke->endY = y;
+      stroke->feed = -1.0f;
+      stroke->reversible = true;
+      penDown = true;
+      pendingTravel = false;
+    }
+
+    if (isDraw) {
+      // Arcs would need their direction and center rewritten to run backwards
+      if (isArc || !hasWord(&block, 'X') || !hasWord(&block, 'Y')) {
+        stroke->reversible = false;
+      }
+      // Run backwards, a stroke's feed changes would land on other moves
+      if (stroke->feed < 0.0f) {
+        stroke->feed = feed;
+      } else if (feed != stroke->feed) {
+        stroke->reversible = false;
+      }
+      if (feed > 0.0f) {
+        layout->hasFeed = true;
+      } else {
+        drewWithoutFeed = true;
+      }
+      x = nx;
+      y = ny;
+      stroke->end = r->offset;
+      stroke->endX = x;
+      stroke->endY = y;
+    }
+  }
+
+  if (!inBody) return false;
+  if (layout->hasFeed && drewWithoutFeed) return false;
+  if (pendingTravel) {
+    layout->hasFinalTravel = true;
+    layout->finalX = x;
+    layout->finalY = y;
+  }
+  return travelStrokeCount > 1;
+}
+
+/**
+ * Order strokes greedily: from where the pen is, draw the stroke with the
+ * nearest end next, reversed if its far end is the near one
+ */
+void travelNearestNeighbour(const TravelLayout* layout) {
+  // Unvisited strokes are kept packed at the back of the tour array
+  for (int i = 0; i < travelStrokeCount; i++) {
+    travelTour[i].stroke = i;
+    travelTour[i].reversed = false;
+  }
+
+  float x = layout->originX;
+  float y = layout->originY;
+  uint32_t lastYield = millis();
+
+  for (int pos = 0; pos < travelStrokeCount; pos++) {
+    int best = pos;
+    bool bestReversed = false;
+    float bestDistance = 1e30f;
+
+    for (int i = pos; i < travelStrokeCount; i++) {
+      const TravelStroke* s = &travelStrokes[travelTour[i].stroke];
+      float d = travelDistance(x, y, s->startX, s->startY);
+      if (d < bestDistance) {
+        bestDistance = d;
+        best = i;
+        bestReversed = false;
+      }
+      if (s->reversible) {
+        d = travelDistance(x, y, s->endX, s->endY);
+        if (d < bestDistance) {
+          bestDistance = d;
+          best = i;
+          bestReversed = true;
+        }
+      }
+    }
+
+    TravelStop chosen = travelTour[best];
+    travelTour[best] = travelTour[pos];
+    chosen.reversed = bestReversed;
+    travelTour[pos] = chosen;
+
+    x = travelExitX(&travelTour[pos]);
+    y = travelExitY(&travelTour[pos]);
+    travelYield(&lastYield);
+  }
+}
+
+/**
+ * Pen-up travel of the current tour
+ */
+float travelTourLength(const TravelLayout* layout) {
+  float total = travelDistance(layout->originX, layout->originY,
+                               travelEntryX(&travelTour[0]), travelEntryY(&travelTour[0]));
+  for (int i = 1; i < travelStrokeCount; i++) {
+    total += travelDistance(travelExitX(&travelTour[i - 1]), travelExitY(&travelTour[i - 1]),
+                            travelEntryX(&travelTour[i]), travelEntryY(&travelTour[i]));
+  }
+  if (layout->hasFinalTravel) {
+    const TravelStop* last = &travelTour[travelStrokeCount - 1];
+    total += travelDistance(travelExitX(last), travelExitY(last), layout->finalX, layout->finalY);
+  }
+  return total;
+}
+
+/**
+ * Improve the tour with 2-opt: reversing a run of stops also reverses
+ * every stroke in it, which only changes the two travel moves at its ends.
+ * Skipped if any stroke cannot be drawn backwards.
+ */
+void travelTwoOpt(const TravelLayout* layout) {
+  for (int i = 0; i < travelStrokeCount; i++) {
+    if (!travelStrokes[i].reversible) return;
+  }
+
+  int n = travelStrokeCount;
+  uint32_t startTime = millis();
+  uint32_t lastYield = startTime;
+  bool improved = true;
+
+  while (improved && millis() - startTime < TRAVEL_TIME_BUDGET_MS) {
+    improved = false;
+
+    for (int i = 0; i < n - 1; i++) {
+      float ax = i == 0 ? layout->originX : travelExitX(&travelTour[i - 1]);
+      float ay = i == 0 ? layout->originY : travelExitY(&travelTour[i - 1]);
+      float bx = travelEntryX(&travelTour[i]);
+      float by = travelEntryY(&travelTour[i]);
+      float ab = travelDistance(ax, ay, bx, by);
+
+      for (int j = i + 1; j < n; j++) {
+        float cx = travelExitX(&travelTour[j]);
+        float cy = travelExitY(&travelTour[j]);
+
+        // Travel out of the run, to the next stroke or the final G0
+        bool hasNext = j < n - 1 || layout->hasFinalTravel;
+        float dx = j < n - 1 ? travelEntryX(&travelTour[j + 1]) : layout->finalX;
+        float dy = j < n - 1 ? travelEntryY(&travelTour[j + 1]) : layout->finalY;
+
+        float before = ab + (hasNext ? travelDistance(cx, cy, dx, dy) : 0);
+        float after = travelDistance(ax, ay, cx, cy) + (hasNext ? travelDistance(bx, by, dx, dy) : 0);
+
+        if (after < before - 0.01f) {
+          for (int lo = i, hi = j; lo <= hi; lo++, hi--) {
+            TravelStop swap = travelTour[lo];
+            travelTour[lo] = travelTour[hi];
+            travelTour[hi] = swap;
+            travelTour[lo].reversed = !travelTour[lo].reversed;
+            if (lo != hi) travelTour[hi].reversed = !travelTour[hi].reversed;
+          }
+          bx = travelEntryX(&travelTour[i]);
+          by = travelEntryY(&travelTour[i]);
+          ab = travelDistance(ax, ay, bx, by);
+          improved = true;
+        }
+      }
+
+      travelYield(&lastYield);
+      if (millis() - startTime >= TRAVEL_TIME_BUDGET_MS) break;
+    }
+  }
+}
+
+/**
+ * Write a formatted line to the output file
+ * @return false if the write failed (flash full)
+ */
+bool travelWriteLine(File& out, const char* format, float x, float y, int* lines) {
+  char line[GCODE_LINE_MAX];
+  int length = snprintf(line, sizeof(line), format, x, y);
+  (*lines)++;
+  return out.write((const uint8_t*)line, length) == (size_t)length;
+}
+
+/**
+ * Copy a byte range of the input file to the output file
+ */
+bool travelCopyRange(File& in, File& out, uint32_t begin, uint32_t end, int* lines) {
+  if (!in.seek(begin)) return false;
+
+  char last = '\n';
+  uint32_t pos = begin;
+  while (pos < end) {
+    size_t length = min((uint32_t)TRAVEL_CHUNK, end - pos);
+    if (in.read((uint8_t*)travelChunk, length) != length) return false;
+    if (out.write((const uint8_t*)travelChunk, length) != length) return false;
+    for (size_t i = 0; i < length; i++) {
+      if (travelChunk[i] == '\n') (*lines)++;
+    }
+    last = travelChunk[length - 1];
+    pos += length;
+  }
+
+  if (last != '\n') {
+    (*lines)++;
+    if (out.write((const uint8_t*)"\n", 1) != 1) return false;
+  }
+  return true;
+}
+
+/**
+ * Write the G1 lines of a stroke end to start. The file is read backwards
+ * a chunk at a time; the last G1's target is where the pen goes down, and
+ * each earlier target (then the stroke start) becomes the next G1.
+ */
+bool travelWriteReversed(File& in, File& out, const TravelStroke* s, int* lines) {
+  char line[GCODE_LINE_MAX];
+  bool skippedLast = false;
+  uint32_t pos = s->end;
+
+  while (pos > s->begin) {
+    uint32_t from = pos - s->begin > TRAVEL_CHUNK ? pos - TRAVEL_CHUNK : s->begin;
+    size_t length = pos - from;
+    if (!in.seek(from) || in.read((uint8_t*)travelChunk, length) != length) return false;
+
+    // Walk complete lines from the back of the chunk. A line cut off at the
+    // front is left for the next chunk; lines are far shorter than a chunk.
+    size_t lineEnd = length;
+    while (lineEnd > 0) {
+      size_t textEnd = travelChunk[lineEnd - 1] == '\n' ? lineEnd - 1 : lineEnd;
+      size_t lineBegin = textEnd;
+      while (lineBegin > 0 && travelChunk[lineBegin - 1] != '\n') lineBegin--;
+      if (lineBegin == 0 && from > s->begin) break;
+
+      size_t textLength = 0;
+      for (size_t i = lineBegin; i < textEnd && textLength < sizeof(line) - 1; i++) {
+        if (travelChunk[i] != '\r') line[textLength++] = travelChunk[i];
+      }
+      line[textLength] = '\0';
+
+      GCodeBlock block;
+      if (parseGCodeLine(line, &block) && hasWord(&block, 'G') && (int)wordValue(&block, 'G') == 1) {
+        if (skippedLast) {
+          if (!travelWriteLine(out, "G1 X%.3f Y%.3f\n", wordValue(&block, 'X'), wordValue(&block, 'Y'), lines)) {
+            return false;
+          }
+        }
+        skippedLast = true;
+      }
+      lineEnd = lineBegin;
+    }
+    pos = from + lineEnd;
+  }
+
+  if (skippedLast) {
+    return travelWriteLine(out, "G1 X%.3f Y%.3f\n", s->startX, s->startY, lines);
+  }
+  return true;
+}
+
+/**
+ * Write the reordered program
+ * @return false if the output could not be written (flash full)
+ */
+bool travelWriteProgram(File& in, File& out, uint32_t fileSize, const TravelLayout* layout, int* lines) {
+  uint32_t lastYield = millis();
+  *lines = 0;
+
+  if (layout->prologueEnd > 0 && !travelCopyRange(in, out, 0, layout->prologueEnd, lines)) return false;
+
+  for (int i = 0; i < travelStrokeCount; i++) {
+    const TravelStop* stop = &travelTour[i];
+    const TravelStroke* s = &travelStrokes[stop->stroke];
+
+    // The travel to a stroke also restores the feed it was drawn at
+    char entry[GCODE_LINE_MAX];
+    int length = layout->hasFeed && s->feed > 0.0f
+        ? snprintf(entry, sizeof(entry), "G0 X%.3f Y%.3f F%.1f\nM3\n", travelEntryX(stop), travelEntryY(stop), s->feed)
+        : snprintf(entry, sizeof(entry), "G0 X%.3f Y%.3f\nM3\n", travelEntryX(stop), travelEntryY(stop));
+    if (out.write((const uint8_t*)entry, length) != (size_t)length) return false;
+    (*lines) += 2;
+
+    if (stop->reversed) {
+      if (!travelWriteReversed(in, out, s, lines)) return false;
+    } else if (s->end > s->begin) {
+      if (!travelCopyRange(in, out, s->begin, s->end, lines)) return false;
+    }
+
+    (*lines)++;
+    if (out.write((const uint8_t*)"M5\n", 3) != 3) return false;
+    travelYield(&lastYield);
+  }
+
+  if (layout->hasFinalTravel) {
+    if (!travelWriteLine(out, "G0 X%.3f Y%.3f\n", layout->finalX, layout->finalY, lines)) return false;
+  }
+
+  if (layout->epilogueBegin < fileSize) {
+    if (!travelCopyRange(in, out, layout->epilogueBegin, fileSize, lines)) return false;
+  }
+  return true;
+}
+
+/**
+ * Reorder the strokes of a spooled program to cut pen-up travel:
+ * nearest-neighbour ordering with stroke reversal, then 2-opt. The file is
+ * only replaced if travel gets shorter and the rewrite fits in flash;
+ * otherwise the program runs as sent, and report->outcome says why.
+ * @param path Spool file, rewritten in place
+ * @param report Travel before and after, and the outcome
+ * @param lines Receives the new line count if the file was rewritten
+ * @return true if the file was rewritten
+ */
+bool travelOptimizeFile(const String& path, TravelReport* report, int* lines) {
+  report->beforeMm = 0;
+  report->afterMm = 0;
+  report->strokes = 0;
+  report->outcome = TRAVEL_WRITE_FAILED;
+
+  File in = LittleFS.open(path, "r");
+  if (!in) return false;
+  uint32_t fileSize = in.size();
+
+  travelStrokes = (TravelStroke*)malloc(sizeof(TravelStroke) * TRAVEL_MAX_STROKES);
+  travelTour = (TravelStop*)malloc(sizeof(TravelStop) * TRAVEL_MAX_STROKES);
+
+  TravelLayout layout;
+  bool scanned = false;
+  if (travelStrokes == NULL || travelTour == NULL) {
+    report->outcome = TRAVEL_NO_MEMORY;
+  } else {
+    scanned = travelScan(in, fileSize, &layout);
+    if (!scanned) report->outcome = layout.tooManyStrokes ? TRAVEL_TOO_MANY_STROKES : TRAVEL_KEPT;
+  }
+
+  if (scanned) {
+    report->outcome = TRAVEL_KEPT;
+    report->strokes = travelStrokeCount;
+    report->beforeMm = layout.travelMm;
+    report->afterMm = layout.travelMm;
+
+    travelNearestNeighbour(&layout);
+    travelTwoOpt(&layout);
+    float optimized = travelTourLength(&layout);
+
+    if (optimized < layout.travelMm) {
+      String tempPath = path + ".tmp";
+      File out = LittleFS.open(tempPath, "w");
+      bool written = out && travelWriteProgram(in, out, fileSize, &layout, lines);
+      if (out) out.close();
+      in.close();
+
+      // LittleFS renames over the original atomically
+      if (written && LittleFS.rename(tempPath, path)) {
+        report->afterMm = optimized;
+        report->outcome = TRAVEL_REWRITTEN;
+      } else {
+        LittleFS.remove(tempPath);
+        report->outcome = TRAVEL_WRITE_FAILED;
+      }
+    }
+  }
+
+  if (in) in.close();
+  free(travelStrokes);
+  free(travelTour);
+  travelStrokes = NULL;
+  travelTour = NULL;
+  return report->outcome == TRAVEL_REWRITTEN;
+}
+
+#endif // TRAVEL_OPTIMIZER_H
@@ -0,0 +1,2731 @@
+; PlotterBot G-code
+G90
+G28
+G0 X8.00 Y8.80
+M3
+G1 X10.40 Y16.00
+M5
+G0 X12.80 Y8.80
+M3
+G1 X10.40 Y16.00
+M5
+G0 X9.03 Y13.60
+M3
+G1 X11.77 Y13.60
+M5
+G0 X18.08 Y9.83
+M3
+G1 X17.74 Y9.14
+G1 X17.05 Y8.80
+G1 X16.02 Y8.80
+G1 X15.34 Y9.14
+G1 X14.65 Y9.83
+G1 X14.31 Y10.51
+G1 X13.97 Y11.54
+G1 X13.97 Y13.26
+G1 X14.31 Y14.29
+G1 X14.65 Y14.97
+G1 X15.34 Y15.66
+G1 X16.02 Y16.00
+G1 X17.05 Y16.00
+G1 X17.74 Y15.66
+G1 X18.08 Y14.97
+M5
+G0 X17.87 Y8.80
+M3
+G1 X17.87 Y16.00
+M5
+G0 X17.87 Y8.80
+M3
+G1 X20.62 Y16.00
+M5
+G0 X23.36 Y8.80
+M3
+G1 X20.62 Y16.00
+M5
+G0 X23.36 Y8.80
+M3
+G1 X23.36 Y16.00
+M5
+G0 X22.81 Y8.80
+M3
+G1 X22.81 Y16.00
+M5
+G0 X22.81 Y8.80
+M3
+G1 X27.95 Y8.80
+M5
+G0 X22.81 Y12.23
+M3
+G1 X26.93 Y12.23
+M5
+G0 X22.81 Y16.00
+M3
+G1 X27.95 Y16.00
+M5
+G0 X32.69 Y8.80
+M3
+G1 X34.06 Y16.00
+M5
+G0 X35.43 Y8.80
+M3
+G1 X34.06 Y16.00
+M5
+G0 X35.43 Y8.80
+M3
+G1 X36.80 Y16.00
+M5
+G0 X38.17 Y8.80
+M3
+G1 X36.80 Y16.00
+M5
+G0 X37.62 Y8.80
+M3
+G1 X37.62 Y16.00
+M5
+G0 X42.56 Y8.80
+M3
+G1 X42.56 Y16.00
+M5
+G0 X42.56 Y8.80
+M3
+G1 X45.65 Y8.80
+G1 X46.67 Y9.14
+G1 X47.36 Y9.83
+G1 X47.70 Y10.51
+G1 X48.05 Y11.54
+G1 X48.05 Y13.26
+G1 X47.70 Y14.29
+G1 X47.36 Y14.97
+G1 X46.67 Y15.66
+G1 X45.65 Y16.00
+G1 X42.56 Y16.00
+M5
+G0 X52.64 Y9.83
+M3
+G1 X52.30 Y9.14
+G1 X51.61 Y8.80
+G1 X50.58 Y8.80
+G1 X49.90 Y9.14
+G1 X49.21 Y9.83
+G1 X48.87 Y10.51
+G1 X48.53 Y11.54
+G1 X48.53 Y13.26
+G1 X48.87 Y14.29
+G1 X49.21 Y14.97
+G1 X49.90 Y15.66
+G1 X50.58 Y16.00
+G1 X51.61 Y16.00
+G1 X52.30 Y15.66
+G1 X52.64 Y14.97
+G1 X52.64 Y13.94
+G1 X52.30 Y13.26
+G1 X51.61 Y12.91
+G1 X50.58 Y12.91
+M5
+G0 X52.43 Y8.80
+M3
+G1 X52.43 Y16.00
+M5
+G0 X52.43 Y8.80
+M3
+G1 X57.58 Y8.80
+M5
+G0 X52.43 Y12.23
+M3
+G1 X56.55 Y12.23
+M5
+G0 X52.43 Y16.00
+M3
+G1 X57.58 Y16.00
+M5
+G0 X57.37 Y8.80
+M3
+G1 X62.86 Y8.80
+M5
+G0 X60.11 Y8.80
+M3
+G1 X60.11 Y16.00
+M5
+G0 X67.45 Y9.83
+M3
+G1 X67.11 Y9.14
+G1 X66.08 Y8.80
+G1 X65.05 Y8.80
+G1 X64.02 Y9.14
+G1 X63.68 Y9.83
+G1 X64.02 Y10.51
+G1 X65.05 Y10.86
+G1 X66.08 Y10.86
+G1 X67.11 Y11.20
+G1 X67.45 Y11.89
+G1 X67.45 Y12.91
+G1 X67.11 Y13.60
+G1 X66.08 Y13.94
+G1 X65.05 Y13.94
+G1 X64.02 Y13.60
+G1 X63.68 Y12.91
+M5
+G0 X8.00 Y19.60
+M3
+G1 X8.00 Y24.74
+G1 X8.34 Y25.77
+G1 X9.03 Y26.46
+G1 X10.06 Y26.80
+G1 X11.43 Y26.80
+G1 X12.46 Y26.46
+G1 X13.14 Y25.77
+G1 X13.49 Y24.74
+G1 X13.49 Y19.60
+M5
+G0 X12.94 Y19.60
+M3
+G1 X12.94 Y26.80
+M5
+G0 X12.94 Y19.60
+M3
+G1 X18.42 Y26.80
+M5
+G0 X18.42 Y19.60
+M3
+G1 X18.42 Y26.80
+M5
+G0 X17.87 Y19.60
+M3
+G1 X17.87 Y26.80
+M5
+G0 X22.81 Y19.60
+M3
+G1 X28.30 Y19.60
+M5
+G0 X25.55 Y19.60
+M3
+G1 X25.55 Y26.80
+M5
+G0 X37.83 Y20.63
+M3
+G1 X37.49 Y19.94
+G1 X36.46 Y19.60
+G1 X35.43 Y19.60
+G1 X34.40 Y19.94
+G1 X34.06 Y20.63
+G1 X34.40 Y21.31
+G1 X35.43 Y21.66
+G1 X36.46 Y21.66
+G1 X37.49 Y22.00
+G1 X37.83 Y22.69
+G1 X37.83 Y23.71
+G1 X37.49 Y24.40
+G1 X36.46 Y24.74
+G1 X35.43 Y24.74
+G1 X34.40 Y24.40
+G1 X34.06 Y23.71
+M5
+G0 X37.62 Y19.60
+M3
+G1 X37.62 Y26.80
+M5
+G0 X37.62 Y19.60
+M3
+G1 X42.77 Y19.60
+M5
+G0 X37.62 Y23.03
+M3
+G1 X41.74 Y23.03
+M5
+G0 X37.62 Y26.80
+M3
+G1 X42.77 Y26.80
+M5
+G0 X42.56 Y19.60
+M3
+G1 X45.30 Y26.80
+M5
+G0 X48.05 Y19.60
+M3
+G1 X45.30 Y26.80
+M5
+G0 X47.50 Y19.60
+M3
+G1 X47.50 Y26.80
+M5
+G0 X47.50 Y19.60
+M3
+G1 X52.64 Y19.60
+M5
+G0 X47.50 Y23.03
+M3
+G1 X51.61 Y23.03
+M5
+G0 X47.50 Y26.80
+M3
+G1 X52.64 Y26.80
+M5
+G0 X52.43 Y19.60
+M3
+G1 X52.43 Y26.80
+M5
+G0 X52.43 Y19.60
+M3
+G1 X57.92 Y26.80
+M5
+G0 X57.92 Y19.60
+M3
+G1 X57.92 Y26.80
+M5
+G0 X8.00 Y30.40
+M3
+G1 X8.00 Y37.60
+M5
+G0 X13.49 Y30.40
+M3
+G1 X13.49 Y37.60
+M5
+G0 X8.00 Y33.83
+M3
+G1 X13.49 Y33.83
+M5
+G0 X12.94 Y30.40
+M3
+G1 X15.34 Y37.60
+M5
+G0 X17.74 Y30.40
+M3
+G1 X15.34 Y37.60
+M5
+G0 X13.97 Y35.20
+M3
+G1 X16.71 Y35.20
+M5
+G0 X17.87 Y30.40
+M3
+G1 X17.87 Y37.60
+M5
+G0 X17.87 Y30.40
+M3
+G1 X20.96 Y30.40
+G1 X21.99 Y30.74
+G1 X22.33 Y31.09
+G1 X22.67 Y31.77
+G1 X22.67 Y32.80
+G1 X22.33 Y33.49
+G1 X21.99 Y33.83
+G1 X20.96 Y34.17
+G1 X17.87 Y34.17
+M5
+G0 X20.96 Y34.17
+M3
+G1 X23.36 Y37.60
+M5
+G0 X22.81 Y30.40
+M3
+G1 X22.81 Y37.60
+M5
+G0 X22.81 Y30.40
+M3
+G1 X25.90 Y30.40
+G1 X26.93 Y30.74
+G1 X27.27 Y31.09
+G1 X27.61 Y31.77
+G1 X27.61 Y32.46
+G1 X27.27 Y33.14
+G1 X26.93 Y33.49
+G1 X25.90 Y33.83
+M5
+G0 X22.81 Y33.83
+M3
+G1 X25.90 Y33.83
+G1 X26.93 Y34.17
+G1 X27.27 Y34.51
+G1 X27.61 Y35.20
+G1 X27.61 Y36.23
+G1 X27.27 Y36.91
+G1 X26.93 Y37.26
+G1 X25.90 Y37.60
+G1 X22.81 Y37.60
+M5
+G0 X30.15 Y30.40
+M3
+G1 X29.46 Y30.74
+G1 X28.78 Y31.43
+G1 X28.43 Y32.11
+G1 X28.09 Y33.14
+G1 X28.09 Y34.86
+G1 X28.43 Y35.89
+G1 X28.78 Y36.57
+G1 X29.46 Y37.26
+G1 X30.15 Y37.60
+G1 X30.83 Y37.60
+G1 X31.52 Y37.26
+G1 X32.21 Y36.57
+G1 X32.55 Y35.89
+G1 X32.89 Y34.86
+G1 X32.89 Y33.14
+G1 X32.55 Y32.11
+G1 X32.21 Y31.43
+G1 X31.52 Y30.74
+G1 X30.83 Y30.40
+G1 X30.15 Y30.40
+M5
+G0 X32.69 Y30.40
+M3
+G1 X32.69 Y35.54
+G1 X33.03 Y36.57
+G1 X33.71 Y37.26
+G1 X34.74 Y37.60
+G1 X36.11 Y37.60
+G1 X37.14 Y37.26
+G1 X37.83 Y36.57
+G1 X38.17 Y35.54
+G1 X38.17 Y30.40
+M5
+G0 X37.62 Y30.40
+M3
+G1 X37.62 Y37.60
+M5
+G0 X37.62 Y30.40
+M3
+G1 X40.71 Y30.40
+G1 X41.74 Y30.74
+G1 X42.08 Y31.09
+G1 X42.42 Y31.77
+G1 X42.42 Y32.80
+G1 X42.08 Y33.49
+G1 X41.74 Y33.83
+G1 X40.71 Y34.17
+G1 X37.62 Y34.17
+M5
+G0 X40.71 Y34.17
+M3
+G1 X43.11 Y37.60
+M5
+G0 X47.50 Y30.40
+M3
+G1 X47.50 Y37.60
+M5
+G0 X47.50 Y30.40
+M3
+G1 X50.58 Y30.40
+G1 X51.61 Y30.74
+G1 X51.95 Y31.09
+G1 X52.30 Y31.77
+G1 X52.30 Y32.80
+G1 X51.95 Y33.49
+G1 X51.61 Y33.83
+G1 X50.58 Y34.17
+G1 X47.50 Y34.17
+M5
+G0 X50.58 Y34.17
+M3
+G1 X52.98 Y37.60
+M5
+G0 X54.83 Y30.40
+M3
+G1 X54.15 Y30.74
+G1 X53.46 Y31.43
+G1 X53.12 Y32.11
+G1 X52.78 Y33.14
+G1 X52.78 Y34.86
+G1 X53.12 Y35.89
+G1 X53.46 Y36.57
+G1 X54.15 Y37.26
+G1 X54.83 Y37.60
+G1 X55.52 Y37.60
+G1 X56.21 Y37.26
+G1 X56.89 Y36.57
+G1 X57.23 Y35.89
+G1 X57.58 Y34.86
+G1 X57.58 Y33.14
+G1 X57.23 Y32.11
+G1 X56.89 Y31.43
+G1 X56.21 Y30.74
+G1 X55.52 Y30.40
+G1 X54.83 Y30.40
+M5
+G0 X57.37 Y30.40
+M3
+G1 X59.77 Y37.60
+M5
+G0 X62.17 Y30.40
+M3
+G1 X59.77 Y37.60
+M5
+G0 X58.40 Y35.20
+M3
+G1 X61.14 Y35.20
+M5
+G0 X62.31 Y30.40
+M3
+G1 X62.31 Y37.60
+M5
+G0 X62.31 Y30.40
+M3
+G1 X65.39 Y30.40
+G1 X66.42 Y30.74
+G1 X67.11 Y31.43
+G1 X67.45 Y32.11
+G1 X67.79 Y33.14
+G1 X67.79 Y34.86
+G1 X67.45 Y35.89
+G1 X67.11 Y36.57
+G1 X66.42 Y37.26
+G1 X65.39 Y37.60
+G1 X62.31 Y37.60
+M5
+G0 X8.00 Y68.80
+M3
+G1 X8.00 Y76.00
+M5
+G0 X8.00 Y68.80
+M3
+G1 X11.09 Y68.80
+G1 X12.11 Y69.14
+G1 X12.46 Y69.49
+G1 X12.80 Y70.17
+G1 X12.80 Y71.54
+G1 X12.46 Y72.23
+G1 X12.11 Y72.57
+G1 X11.09 Y72.91
+G1 X8.00 Y72.91
+M5
+G0 X12.94 Y68.80
+M3
+G1 X12.94 Y76.00
+M5
+G0 X12.94 Y76.00
+M3
+G1 X17.74 Y76.00
+M5
+G0 X20.27 Y68.80
+M3
+G1 X19.59 Y69.14
+G1 X18.90 Y69.83
+G1 X18.56 Y70.51
+G1 X18.22 Y71.54
+G1 X18.22 Y73.26
+G1 X18.56 Y74.29
+G1 X18.90 Y74.97
+G1 X19.59 Y75.66
+G1 X20.27 Y76.00
+G1 X20.96 Y76.00
+G1 X21.65 Y75.66
+G1 X22.33 Y74.97
+G1 X22.67 Y74.29
+G1 X23.02 Y73.26
+G1 X23.02 Y71.54
+G1 X22.67 Y70.51
+G1 X22.33 Y69.83
+G1 X21.65 Y69.14
+G1 X20.96 Y68.80
+G1 X20.27 Y68.80
+M5
+G0 X22.81 Y68.80
+M3
+G1 X28.30 Y68.80
+M5
+G0 X25.55 Y68.80
+M3
+G1 X25.55 Y76.00
+M5
+G0 X27.75 Y68.80
+M3
+G1 X33.23 Y68.80
+M5
+G0 X30.49 Y68.80
+M3
+G1 X30.49 Y76.00
+M5
+G0 X32.69 Y68.80
+M3
+G1 X32.69 Y76.00
+M5
+G0 X32.69 Y68.80
+M3
+G1 X37.83 Y68.80
+M5
+G0 X32.69 Y72.23
+M3
+G1 X36.80 Y72.23
+M5
+G0 X32.69 Y76.00
+M3
+G1 X37.83 Y76.00
+M5
+G0 X37.62 Y68.80
+M3
+G1 X37.62 Y76.00
+M5
+G0 X37.62 Y68.80
+M3
+G1 X40.71 Y68.80
+G1 X41.74 Y69.14
+G1 X42.08 Y69.49
+G1 X42.42 Y70.17
+G1 X42.42 Y71.20
+G1 X42.08 Y71.89
+G1 X41.74 Y72.23
+G1 X40.71 Y72.57
+G1 X37.62 Y72.57
+M5
+G0 X40.71 Y72.57
+M3
+G1 X43.11 Y76.00
+M5
+G0 X47.50 Y68.80
+M3
+G1 X47.50 Y76.00
+M5
+G0 X47.50 Y68.80
+M3
+G1 X50.58 Y68.80
+G1 X51.61 Y69.14
+G1 X51.95 Y69.49
+G1 X52.30 Y70.17
+G1 X52.30 Y70.86
+G1 X51.95 Y71.54
+G1 X51.61 Y71.89
+G1 X50.58 Y72.23
+M5
+G0 X47.50 Y72.23
+M3
+G1 X50.58 Y72.23
+G1 X51.61 Y72.57
+G1 X51.95 Y72.91
+G1 X52.30 Y73.60
+G1 X52.30 Y74.63
+G1 X51.95 Y75.31
+G1 X51.61 Y75.66
+G1 X50.58 Y76.00
+G1 X47.50 Y76.00
+M5
+G0 X54.83 Y68.80
+M3
+G1 X54.15 Y69.14
+G1 X53.46 Y69.83
+G1 X53.12 Y70.51
+G1 X52.78 Y71.54
+G1 X52.78 Y73.26
+G1 X53.12 Y74.29
+G1 X53.46 Y74.97
+G1 X54.15 Y75.66
+G1 X54.83 Y76.00
+G1 X55.52 Y76.00
+G1 X56.21 Y75.66
+G1 X56.89 Y74.97
+G1 X57.23 Y74.29
+G1 X57.58 Y73.26
+G1 X57.58 Y71.54
+G1 X57.23 Y70.51
+G1 X56.89 Y69.83
+G1 X56.21 Y69.14
+G1 X55.52 Y68.80
+G1 X54.83 Y68.80
+M5
+G0 X57.37 Y68.80
+M3
+G1 X62.86 Y68.80
+M5
+G0 X60.11 Y68.80
+M3
+G1 X60.11 Y76.00
+M5
+G0 X8.00 Y79.60
+M3
+G1 X9.37 Y86.80
+M5
+G0 X10.74 Y79.60
+M3
+G1 X9.37 Y86.80
+M5
+G0 X10.74 Y79.60
+M3
+G1 X12.11 Y86.80
+M5
+G0 X13.49 Y79.60
+M3
+G1 X12.11 Y86.80
+M5
+G0 X15.34 Y79.60
+M3
+G1 X14.65 Y79.94
+G1 X13.97 Y80.63
+G1 X13.62 Y81.31
+G1 X13.28 Y82.34
+G1 X13.28 Y84.06
+G1 X13.62 Y85.09
+G1 X13.97 Y85.77
+G1 X14.65 Y86.46
+G1 X15.34 Y86.80
+G1 X16.02 Y86.80
+G1 X16.71 Y86.46
+G1 X17.39 Y85.77
+G1 X17.74 Y85.09
+G1 X18.08 Y84.06
+G1 X18.08 Y82.34
+G1 X17.74 Y81.31
+G1 X17.39 Y80.63
+G1 X16.71 Y79.94
+G1 X16.02 Y79.60
+G1 X15.34 Y79.60
+M5
+G0 X17.87 Y79.60
+M3
+G1 X17.87 Y86.80
+M5
+G0 X17.87 Y79.60
+M3
+G1 X20.96 Y79.60
+G1 X21.99 Y79.94
+G1 X22.33 Y80.29
+G1 X22.67 Y80.97
+G1 X22.67 Y82.00
+G1 X22.33 Y82.69
+G1 X21.99 Y83.03
+G1 X20.96 Y83.37
+G1 X17.87 Y83.37
+M5
+G0 X20.96 Y83.37
+M3
+G1 X23.36 Y86.80
+M5
+G0 X22.81 Y79.60
+M3
+G1 X22.81 Y86.80
+M5
+G0 X28.30 Y79.60
+M3
+G1 X22.81 Y84.40
+M5
+G0 X24.87 Y82.69
+M3
+G1 X28.30 Y86.80
+M5
+G0 X32.89 Y80.63
+M3
+G1 X32.55 Y79.94
+G1 X31.52 Y79.60
+G1 X30.49 Y79.60
+G1 X29.46 Y79.94
+G1 X29.12 Y80.63
+G1 X29.46 Y81.31
+G1 X30.49 Y81.66
+G1 X31.52 Y81.66
+G1 X32.55 Y82.00
+G1 X32.89 Y82.69
+G1 X32.89 Y83.71
+G1 X32.55 Y84.40
+G1 X31.52 Y84.74
+G1 X30.49 Y84.74
+G1 X29.46 Y84.40
+G1 X29.12 Y83.71
+M5
+G0 X32.69 Y79.60
+M3
+G1 X32.69 Y86.80
+M5
+G0 X38.17 Y79.60
+M3
+G1 X38.17 Y86.80
+M5
+G0 X32.69 Y83.03
+M3
+G1 X38.17 Y83.03
+M5
+G0 X40.02 Y79.60
+M3
+G1 X39.34 Y79.94
+G1 X38.65 Y80.63
+G1 X38.31 Y81.31
+G1 X37.97 Y82.34
+G1 X37.97 Y84.06
+G1 X38.31 Y85.09
+G1 X38.65 Y85.77
+G1 X39.34 Y86.46
+G1 X40.02 Y86.80
+G1 X40.71 Y86.80
+G1 X41.39 Y86.46
+G1 X42.08 Y85.77
+G1 X42.42 Y85.09
+G1 X42.77 Y84.06
+G1 X42.77 Y82.34
+G1 X42.42 Y81.31
+G1 X42.08 Y80.63
+G1 X41.39 Y79.94
+G1 X40.71 Y79.60
+G1 X40.02 Y79.60
+M5
+G0 X42.56 Y79.60
+M3
+G1 X42.56 Y86.80
+M5
+G0 X42.56 Y79.60
+M3
+G1 X45.65 Y79.60
+G1 X46.67 Y79.94
+G1 X47.02 Y80.29
+G1 X47.36 Y80.97
+G1 X47.36 Y82.34
+G1 X47.02 Y83.03
+G1 X46.67 Y83.37
+G1 X45.65 Y83.71
+G1 X42.56 Y83.71
+M5
+G0 X8.00 Y90.40
+M3
+G1 X8.00 Y97.60
+M5
+G0 X8.00 Y90.40
+M3
+G1 X11.09 Y90.40
+G1 X12.11 Y90.74
+G1 X12.46 Y91.09
+G1 X12.80 Y91.77
+G1 X12.80 Y92.46
+G1 X12.46 Y93.14
+G1 X12.11 Y93.49
+G1 X11.09 Y93.83
+M5
+G0 X8.00 Y93.83
+M3
+G1 X11.09 Y93.83
+G1 X12.11 Y94.17
+G1 X12.46 Y94.51
+G1 X12.80 Y95.20
+G1 X12.80 Y96.23
+G1 X12.46 Y96.91
+G1 X12.11 Y97.26
+G1 X11.09 Y97.60
+G1 X8.00 Y97.60
+M5
+G0 X12.94 Y90.40
+M3
+G1 X12.94 Y97.60
+M5
+G0 X12.94 Y90.40
+M3
+G1 X18.08 Y90.40
+M5
+G0 X12.94 Y93.83
+M3
+G1 X17.05 Y93.83
+M5
+G0 X12.94 Y97.60
+M3
+G1 X18.08 Y97.60
+M5
+G0 X17.87 Y90.40
+M3
+G1 X17.87 Y97.60
+M5
+G0 X17.87 Y90.40
+M3
+G1 X23.36 Y97.60
+M5
+G0 X23.36 Y90.40
+M3
+G1 X23.36 Y97.60
+M5
+G0 X27.95 Y91.43
+M3
+G1 X27.61 Y90.74
+G1 X26.93 Y90.40
+G1 X25.90 Y90.40
+G1 X25.21 Y90.74
+G1 X24.53 Y91.43
+G1 X24.18 Y92.11
+G1 X23.84 Y93.14
+G1 X23.84 Y94.86
+G1 X24.18 Y95.89
+G1 X24.53 Y96.57
+G1 X25.21 Y97.26
+G1 X25.90 Y97.60
+G1 X26.93 Y97.60
+G1 X27.61 Y97.26
+G1 X27.95 Y96.57
+M5
+G0 X27.75 Y90.40
+M3
+G1 X27.75 Y97.60
+M5
+G0 X33.23 Y90.40
+M3
+G1 X33.23 Y97.60
+M5
+G0 X27.75 Y93.83
+M3
+G1 X33.23 Y93.83
+M5
+G0 X37.62 Y90.40
+M3
+G1 X43.11 Y90.40
+M5
+G0 X40.37 Y90.40
+M3
+G1 X40.37 Y97.60
+M5
+G0 X42.56 Y90.40
+M3
+G1 X43.93 Y97.60
+M5
+G0 X45.30 Y90.40
+M3
+G1 X43.93 Y97.60
+M5
+G0 X45.30 Y90.40
+M3
+G1 X46.67 Y97.60
+M5
+G0 X48.05 Y90.40
+M3
+G1 X46.67 Y97.60
+M5
+G0 X49.90 Y90.40
+M3
+G1 X49.21 Y90.74
+G1 X48.53 Y91.43
+G1 X48.18 Y92.11
+G1 X47.84 Y93.14
+G1 X47.84 Y94.86
+G1 X48.18 Y95.89
+G1 X48.53 Y96.57
+G1 X49.21 Y97.26
+G1 X49.90 Y97.60
+G1 X50.58 Y97.60
+G1 X51.27 Y97.26
+G1 X51.95 Y96.57
+G1 X52.30 Y95.89
+G1 X52.64 Y94.86
+G1 X52.64 Y93.14
+G1 X52.30 Y92.11
+G1 X51.95 Y91.43
+G1 X51.27 Y90.74
+G1 X50.58 Y90.40
+G1 X49.90 Y90.40
+M5
+G0 X13.14 Y129.83
+M3
+G1 X12.80 Y129.14
+G1 X11.77 Y128.80
+G1 X10.74 Y128.80
+G1 X9.71 Y129.14
+G1 X9.37 Y129.83
+G1 X9.71 Y130.51
+G1 X10.74 Y130.86
+G1 X11.77 Y130.86
+G1 X12.80 Y131.20
+G1 X13.14 Y131.89
+G1 X13.14 Y132.91
+G1 X12.80 Y133.60
+G1 X11.77 Y133.94
+G1 X10.74 Y133.94
+G1 X9.71 Y133.60
+G1 X9.37 Y132.91
+M5
+G0 X12.94 Y128.80
+M3
+G1 X12.94 Y136.00
+M5
+G0 X12.94 Y128.80
+M3
+G1 X16.02 Y128.80
+G1 X17.05 Y129.14
+G1 X17.39 Y129.49
+G1 X17.74 Y130.17
+G1 X17.74 Y131.54
+G1 X17.39 Y132.23
+G1 X17.05 Y132.57
+G1 X16.02 Y132.91
+G1 X12.94 Y132.91
+M5
+G0 X17.87 Y128.80
+M3
+G1 X20.27 Y136.00
+M5
+G0 X22.67 Y128.80
+M3
+G1 X20.27 Y136.00
+M5
+G0 X18.90 Y133.60
+M3
+G1 X21.65 Y133.60
+M5
+G0 X22.81 Y128.80
+M3
+G1 X22.81 Y136.00
+M5
+G0 X22.81 Y128.80
+M3
+G1 X25.90 Y128.80
+G1 X26.93 Y129.14
+G1 X27.27 Y129.49
+G1 X27.61 Y130.17
+G1 X27.61 Y131.20
+G1 X27.27 Y131.89
+G1 X26.93 Y132.23
+G1 X25.90 Y132.57
+G1 X22.81 Y132.57
+M5
+G0 X25.90 Y132.57
+M3
+G1 X28.30 Y136.00
+M5
+G0 X27.75 Y128.80
+M3
+G1 X27.75 Y136.00
+M5
+G0 X27.75 Y128.80
+M3
+G1 X32.89 Y128.80
+M5
+G0 X27.75 Y132.23
+M3
+G1 X31.86 Y132.23
+M5
+G0 X27.75 Y136.00
+M3
+G1 X32.89 Y136.00
+M5
+G0 X37.62 Y128.80
+M3
+G1 X37.62 Y136.00
+M5
+G0 X37.62 Y128.80
+M3
+G1 X40.71 Y128.80
+G1 X41.74 Y129.14
+G1 X42.08 Y129.49
+G1 X42.42 Y130.17
+G1 X42.42 Y131.54
+G1 X42.08 Y132.23
+G1 X41.74 Y132.57
+G1 X40.71 Y132.91
+G1 X37.62 Y132.91
+M5
+G0 X42.56 Y128.80
+M3
+G1 X44.96 Y136.00
+M5
+G0 X47.36 Y128.80
+M3
+G1 X44.96 Y136.00
+M5
+G0 X43.59 Y133.60
+M3
+G1 X46.33 Y133.60
+M5
+G0 X47.50 Y128.80
+M3
+G1 X47.50 Y136.00
+M5
+G0 X47.50 Y128.80
+M3
+G1 X50.58 Y128.80
+G1 X51.61 Y129.14
+G1 X51.95 Y129.49
+G1 X52.30 Y130.17
+G1 X52.30 Y131.20
+G1 X51.95 Y131.89
+G1 X51.61 Y132.23
+G1 X50.58 Y132.57
+G1 X47.50 Y132.57
+M5
+G0 X50.58 Y132.57
+M3
+G1 X52.98 Y136.00
+M5
+G0 X52.43 Y128.80
+M3
+G1 X57.92 Y128.80
+M5
+G0 X55.18 Y128.80
+M3
+G1 X55.18 Y136.00
+M5
+G0 X62.51 Y129.83
+M3
+G1 X62.17 Y129.14
+G1 X61.14 Y128.80
+G1 X60.11 Y128.80
+G1 X59.09 Y129.14
+G1 X58.74 Y129.83
+G1 X59.09 Y130.51
+G1 X60.11 Y130.86
+G1 X61.14 Y130.86
+G1 X62.17 Y131.20
+G1 X62.51 Y131.89
+G1 X62.51 Y132.91
+G1 X62.17 Y133.60
+G1 X61.14 Y133.94
+G1 X60.11 Y133.94
+G1 X59.09 Y133.60
+G1 X58.74 Y132.91
+M5
+G0 X8.00 Y139.60
+M3
+G1 X8.00 Y146.80
+M5
+G0 X8.00 Y139.60
+M3
+G1 X11.09 Y139.60
+G1 X12.11 Y139.94
+G1 X12.46 Y140.29
+G1 X12.80 Y140.97
+G1 X12.80 Y141.66
+G1 X12.46 Y142.34
+G1 X12.11 Y142.69
+G1 X11.09 Y143.03
+M5
+G0 X8.00 Y143.03
+M3
+G1 X11.09 Y143.03
+G1 X12.11 Y143.37
+G1 X12.46 Y143.71
+G1 X12.80 Y144.40
+G1 X12.80 Y145.43
+G1 X12.46 Y146.11
+G1 X12.11 Y146.46
+G1 X11.09 Y146.80
+G1 X8.00 Y146.80
+M5
+G0 X12.94 Y139.60
+M3
+G1 X12.94 Y146.80
+M5
+G0 X17.87 Y139.60
+M3
+G1 X17.87 Y146.80
+M5
+G0 X17.87 Y139.60
+M3
+G1 X23.36 Y146.80
+M5
+G0 X23.36 Y139.60
+M3
+G1 X23.36 Y146.80
+M5
+G0 X27.75 Y139.60
+M3
+G1 X27.75 Y146.80
+M5
+G0 X27.75 Y139.60
+M3
+G1 X32.89 Y139.60
+M5
+G0 X27.75 Y143.03
+M3
+G1 X31.86 Y143.03
+M5
+G0 X35.09 Y139.60
+M3
+G1 X34.40 Y139.94
+G1 X33.71 Y140.63
+G1 X33.37 Y141.31
+G1 X33.03 Y142.34
+G1 X33.03 Y144.06
+G1 X33.37 Y145.09
+G1 X33.71 Y145.77
+G1 X34.40 Y146.46
+G1 X35.09 Y146.80
+G1 X35.77 Y146.80
+G1 X36.46 Y146.46
+G1 X37.14 Y145.77
+G1 X37.49 Y145.09
+G1 X37.83 Y144.06
+G1 X37.83 Y142.34
+G1 X37.49 Y141.31
+G1 X37.14 Y140.63
+G1 X36.46 Y139.94
+G1 X35.77 Y139.60
+G1 X35.09 Y139.60
+M5
+G0 X37.62 Y139.60
+M3
+G1 X37.62 Y146.80
+M5
+G0 X37.62 Y139.60
+M3
+G1 X40.71 Y139.60
+G1 X41.74 Y139.94
+G1 X42.08 Y140.29
+G1 X42.42 Y140.97
+G1 X42.42 Y142.00
+G1 X42.08 Y142.69
+G1 X41.74 Y143.03
+G1 X40.71 Y143.37
+G1 X37.62 Y143.37
+M5
+G0 X40.71 Y143.37
+M3
+G1 X43.11 Y146.80
+M5
+G0 X42.56 Y139.60
+M3
+G1 X48.05 Y139.60
+M5
+G0 X45.30 Y139.60
+M3
+G1 X45.30 Y146.80
+M5
+G0 X47.50 Y139.60
+M3
+G1 X50.24 Y143.03
+M5
+G0 X52.98 Y139.60
+M3
+G1 X50.24 Y143.03
+M5
+G0 X50.24 Y143.03
+M3
+G1 X50.24 Y146.80
+M5
+G0 X13.14 Y151.43
+M3
+G1 X12.80 Y150.74
+G1 X11.77 Y150.40
+G1 X10.74 Y150.40
+G1 X9.71 Y150.74
+G1 X9.37 Y151.43
+G1 X9.71 Y152.11
+G1 X10.74 Y152.46
+G1 X11.77 Y152.46
+G1 X12.80 Y152.80
+G1 X13.14 Y153.49
+G1 X13.14 Y154.51
+G1 X12.80 Y155.20
+G1 X11.77 Y155.54
+G1 X10.74 Y155.54
+G1 X9.71 Y155.20
+G1 X9.37 Y154.51
+M5
+G0 X12.94 Y150.40
+M3
+G1 X12.94 Y157.60
+M5
+G0 X18.42 Y150.40
+M3
+G1 X18.42 Y157.60
+M5
+G0 X12.94 Y153.83
+M3
+G1 X18.42 Y153.83
+M5
+G0 X17.87 Y150.40
+M3
+G1 X17.87 Y157.60
+M5
+G0 X17.87 Y150.40
+M3
+G1 X23.02 Y150.40
+M5
+G0 X17.87 Y153.83
+M3
+G1 X21.99 Y153.83
+M5
+G0 X17.87 Y157.60
+M3
+G1 X23.02 Y157.60
+M5
+G0 X22.81 Y150.40
+M3
+G1 X22.81 Y157.60
+M5
+G0 X22.81 Y157.60
+M3
+G1 X27.61 Y157.60
+M5
+G0 X27.75 Y150.40
+M3
+G1 X27.75 Y157.60
+M5
+G0 X27.75 Y150.40
+M3
+G1 X32.89 Y150.40
+M5
+G0 X27.75 Y153.83
+M3
+G1 X31.86 Y153.83
+M5
+G0 X42.77 Y151.43
+M3
+G1 X42.42 Y150.74
+G1 X41.74 Y150.40
+G1 X40.71 Y150.40
+G1 X40.02 Y150.74
+G1 X39.34 Y151.43
+G1 X38.99 Y152.11
+G1 X38.65 Y153.14
+G1 X38.65 Y154.86
+G1 X38.99 Y155.89
+G1 X39.34 Y156.57
+G1 X40.02 Y157.26
+G1 X40.71 Y157.60
+G1 X41.74 Y157.60
+G1 X42.42 Y157.26
+G1 X42.77 Y156.57
+M5
+G0 X150.75 Y64.04
+M3
+G1 X149.80 Y63.30
+G1 X148.86 Y62.55
+G1 X148.11 Y61.61
+G1 X147.62 Y60.52
+G1 X146.87 Y59.58
+G1 X146.43 Y58.47
+G1 X145.79 Y57.45
+G1 X144.99 Y56.56
+G1 X144.47 Y55.47
+G1 X143.70 Y54.56
+G1 X142.85 Y53.70
+G1 X141.81 Y53.12
+G1 X140.65 Y52.81
+G1 X139.53 Y52.39
+G1 X138.55 Y51.70
+G1 X137.71 Y50.84
+G1 X137.01 Y49.86
+G1 X136.08 Y49.10
+G1 X135.20 Y48.28
+G1 X134.33 Y47.46
+G1 X133.32 Y46.81
+G1 X132.49 Y45.94
+G1 X131.47 Y45.31
+G1 X130.57 Y44.51
+G1 X129.53 Y43.92
+G1 X128.37 Y43.63
+G1 X127.25 Y43.20
+G1 X126.20 Y42.62
+G1 X125.30 Y41.82
+G1 X124.57 Y40.87
+G1 X124.05 Y39.79
+G1 X123.69 Y38.64
+G1 X123.03 Y37.64
+G1 X122.27 Y36.71
+G1 X121.34 Y35.95
+G1 X120.49 Y35.11
+G1 X119.57 Y34.33
+G1 X118.57 Y33.67
+G1 X117.70 Y32.85
+G1 X116.74 Y32.12
+G1 X115.97 Y31.20
+G1 X115.23 Y30.26
+G1 X114.34 Y29.46
+G1 X113.42 Y28.68
+G1 X112.54 Y27.87
+G1 X111.62 Y27.10
+G1 X110.62 Y26.44
+G1 X109.77 Y25.60
+G1 X108.97 Y24.70
+G1 X108.09 Y23.88
+G1 X107.33 Y22.95
+G1 X106.62 Y21.99
+G1 X105.85 Y21.06
+G1 X105.12 Y20.11
+G1 X104.26 Y19.28
+G1 X103.21 Y18.69
+G1 X102.20 Y18.04
+G1 X101.20 Y17.38
+G1 X100.18 Y16.75
+G1 X99.09 Y16.24
+G1 X97.99 Y15.77
+G1 X96.80 Y15.59
+G1 X95.66 Y15.22
+G1 X94.47 Y15.05
+G1 X93.28 Y15.16
+G1 X92.09 Y15.02
+G1 X90.90 Y14.80
+G1 X89.74 Y14.50
+G1 X88.70 Y13.92
+G1 X87.57 Y13.49
+G1 X86.45 Y13.08
+G1 X85.29 Y12.74
+G1 X84.17 Y12.32
+G1 X83.10 Y11.77
+G1 X81.96 Y11.40
+G1 X80.77 Y11.25
+G1 X79.59 Y11.02
+G1 X78.40 Y11.14
+G1 X77.23 Y11.42
+G1 X76.04 Y11.50
+G1 X74.84 Y11.39
+G1 X73.64 Y11.33
+G1 X72.44 Y11.36
+G1 X71.24 Y11.38
+G1 X70.06 Y11.59
+G1 X68.91 Y11.94
+G1 X67.72 Y12.04
+G1 X66.55 Y12.30
+G1 X65.36 Y12.49
+G1 X64.27 Y12.99
+G1 X63.09 Y13.23
+G1 X61.90 Y13.34
+G1 X60.71 Y13.48
+G1 X59.57 Y13.85
+G1 X58.37 Y13.99
+G1 X57.21 Y14.29
+G1 X56.11 Y14.77
+G1 X55.02 Y15.28
+G1 X53.87 Y15.60
+G1 X52.75 Y16.02
+G1 X51.79 Y16.75
+G1 X50.88 Y17.53
+G1 X50.17 Y18.50
+G1 X49.21 Y19.22
+G1 X48.35 Y20.06
+G1 X47.46 Y20.86
+G1 X46.53 Y21.61
+G1 X45.44 Y22.12
+G1 X44.29 Y22.48
+G1 X43.09 Y22.50
+G1 X41.91 Y22.70
+G1 X40.77 Y23.09
+G1 X39.64 Y23.48
+G1 X38.53 Y23.94
+G1 X37.36 Y24.21
+G1 X36.19 Y24.47
+G1 X34.99 Y24.41
+G1 X33.82 Y24.16
+G1 X32.65 Y23.90
+M5
+G0 X176.34 Y79.73
+M3
+G1 X175.45 Y78.93
+G1 X174.49 Y78.21
+G1 X173.64 Y77.36
+G1 X173.02 Y76.33
+G1 X172.65 Y75.19
+G1 X172.06 Y74.15
+G1 X171.32 Y73.20
+G1 X170.49 Y72.33
+G1 X169.47 Y71.71
+G1 X168.33 Y71.33
+G1 X167.23 Y70.84
+G1 X166.25 Y70.16
+G1 X165.17 Y69.63
+G1 X164.10 Y69.08
+G1 X162.98 Y68.66
+G1 X161.79 Y68.47
+G1 X160.62 Y68.20
+G1 X159.48 Y67.83
+G1 X158.46 Y67.19
+G1 X157.64 Y66.33
+G1 X156.68 Y65.60
+G1 X155.82 Y64.77
+G1 X154.79 Y64.15
+G1 X153.89 Y63.35
+G1 X152.92 Y62.65
+G1 X151.88 Y62.05
+G1 X150.91 Y61.34
+G1 X149.81 Y60.88
+G1 X148.82 Y60.19
+G1 X147.78 Y59.60
+G1 X146.67 Y59.15
+G1 X145.59 Y58.62
+G1 X144.50 Y58.11
+G1 X143.43 Y57.57
+G1 X142.53 Y56.77
+G1 X141.61 Y56.00
+G1 X140.95 Y55.00
+G1 X140.06 Y54.20
+G1 X139.21 Y53.35
+G1 X138.44 Y52.43
+G1 X137.50 Y51.68
+G1 X136.61 Y50.88
+G1 X135.86 Y49.94
+G1 X135.16 Y48.97
+G1 X134.23 Y48.21
+G1 X133.50 Y47.26
+G1 X132.75 Y46.32
+G1 X131.97 Y45.41
+G1 X131.38 Y44.36
+G1 X130.96 Y43.24
+G1 X130.31 Y42.23
+G1 X129.93 Y41.09
+G1 X129.43 Y40.00
+G1 X128.68 Y39.07
+G1 X127.78 Y38.27
+G1 X126.71 Y37.73
+G1 X125.74 Y37.02
+G1 X124.89 Y36.18
+G1 X124.08 Y35.29
+G1 X123.05 Y34.67
+G1 X121.99 Y34.12
+G1 X121.05 Y33.37
+G1 X120.08 Y32.66
+G1 X119.00 Y32.14
+G1 X117.85 Y31.80
+G1 X116.65 Y31.71
+G1 X115.46 Y31.55
+G1 X114.28 Y31.33
+G1 X113.09 Y31.24
+G1 X111.90 Y31.05
+G1 X110.70 Y31.12
+G1 X109.52 Y30.93
+G1 X108.32 Y31.03
+G1 X107.15 Y30.78
+G1 X105.95 Y30.78
+G1 X104.76 Y30.96
+G1 X103.65 Y31.42
+G1 X102.50 Y31.75
+G1 X101.36 Y32.13
+G1 X100.19 Y32.38
+G1 X99.13 Y32.95
+G1 X98.26 Y33.77
+G1 X97.66 Y34.81
+G1 X97.32 Y35.96
+G1 X96.99 Y37.11
+G1 X96.96 Y38.31
+G1 X96.59 Y39.46
+G1 X96.35 Y40.63
+G1 X96.36 Y41.83
+G1 X96.58 Y43.01
+G1 X96.91 Y44.16
+G1 X97.28 Y45.31
+G1 X97.63 Y46.45
+G1 X97.64 Y47.65
+G1 X97.50 Y48.85
+G1 X97.29 Y50.03
+G1 X97.33 Y51.23
+G1 X97.52 Y52.41
+G1 X97.50 Y53.61
+G1 X97.30 Y54.80
+G1 X97.11 Y55.98
+G1 X97.21 Y57.18
+G1 X97.14 Y58.37
+G1 X96.91 Y59.55
+G1 X96.99 Y60.75
+G1 X97.34 Y61.89
+G1 X97.81 Y63.00
+G1 X98.47 Y64.00
+G1 X99.26 Y64.91
+G1 X99.97 Y65.87
+G1 X100.65 Y66.86
+G1 X101.10 Y67.97
+G1 X101.53 Y69.09
+G1 X101.71 Y70.28
+G1 X101.88 Y71.47
+G1 X102.31 Y72.59
+G1 X102.64 Y73.74
+G1 X102.96 Y74.90
+G1 X103.26 Y76.06
+M5
+G0 X165.24 Y184.76
+M3
+G1 X164.69 Y183.69
+G1 X164.04 Y182.68
+G1 X163.65 Y181.55
+G1 X163.26 Y180.41
+G1 X163.14 Y179.22
+G1 X163.34 Y178.04
+G1 X163.85 Y176.95
+G1 X164.57 Y176.00
+G1 X165.33 Y175.06
+G1 X165.80 Y173.96
+G1 X166.40 Y172.92
+G1 X166.73 Y171.77
+G1 X167.13 Y170.64
+G1 X167.20 Y169.44
+G1 X167.60 Y168.30
+G1 X167.64 Y167.11
+G1 X167.94 Y165.94
+G1 X168.47 Y164.86
+G1 X168.68 Y163.68
+G1 X168.86 Y162.50
+G1 X168.75 Y161.30
+G1 X168.65 Y160.11
+G1 X168.23 Y158.98
+G1 X167.72 Y157.90
+G1 X167.02 Y156.92
+G1 X166.28 Y155.98
+G1 X165.70 Y154.92
+G1 X165.32 Y153.79
+G1 X165.23 Y152.59
+G1 X165.04 Y151.41
+G1 X165.08 Y150.21
+G1 X165.15 Y149.01
+G1 X165.24 Y147.81
+G1 X165.05 Y146.63
+G1 X164.92 Y145.43
+G1 X164.80 Y144.24
+G1 X164.40 Y143.11
+G1 X163.85 Y142.04
+G1 X163.02 Y141.18
+G1 X162.03 Y140.50
+G1 X160.97 Y139.93
+G1 X159.86 Y139.49
+G1 X158.75 Y139.03
+G1 X157.82 Y138.27
+G1 X156.90 Y137.50
+G1 X156.03 Y136.68
+G1 X155.37 Y135.67
+G1 X155.00 Y134.53
+G1 X154.94 Y133.33
+G1 X154.91 Y132.13
+G1 X155.06 Y130.94
+G1 X154.92 Y129.75
+G1 X154.53 Y128.61
+G1 X154.12 Y127.49
+G1 X154.01 Y126.29
+G1 X154.02 Y125.09
+G1 X153.68 Y123.94
+G1 X153.13 Y122.87
+G1 X152.75 Y121.73
+G1 X152.58 Y120.54
+G1 X152.56 Y119.34
+G1 X152.75 Y118.16
+G1 X152.88 Y116.97
+G1 X152.67 Y115.78
+G1 X152.27 Y114.65
+G1 X151.99 Y113.49
+G1 X151.85 Y112.29
+G1 X151.66 Y111.11
+G1 X151.56 Y109.91
+G1 X151.27 Y108.75
+G1 X150.83 Y107.63
+G1 X150.09 Y106.69
+G1 X149.59 Y105.60
+G1 X149.38 Y104.42
+G1 X148.90 Y103.32
+G1 X148.35 Y102.25
+G1 X147.69 Y101.25
+G1 X147.21 Y100.15
+G1 X146.99 Y98.97
+G1 X146.50 Y97.87
+G1 X145.83 Y96.88
+G1 X144.94 Y96.06
+G1 X144.15 Y95.16
+G1 X143.27 Y94.35
+G1 X142.38 Y93.54
+G1 X141.77 Y92.51
+G1 X141.01 Y91.58
+G1 X140.35 Y90.58
+G1 X140.01 Y89.43
+G1 X140.00 Y88.23
+G1 X140.10 Y87.03
+G1 X140.33 Y85.85
+G1 X140.61 Y84.69
+G1 X141.12 Y83.60
+G1 X141.73 Y82.56
+G1 X142.36 Y81.54
+G1 X143.16 Y80.65
+G1 X143.97 Y79.76
+G1 X144.54 Y78.71
+G1 X144.98 Y77.59
+G1 X145.72 Y76.65
+G1 X146.65 Y75.89
+G1 X147.76 Y75.44
+G1 X148.91 Y75.09
+G1 X149.96 Y74.52
+G1 X151.07 Y74.04
+G1 X152.10 Y73.42
+G1 X153.26 Y73.13
+G1 X154.44 Y72.93
+G1 X155.57 Y72.53
+G1 X156.77 Y72.44
+G1 X157.97 Y72.36
+G1 X159.13 Y72.05
+G1 X160.32 Y71.92
+G1 X161.43 Y71.47
+G1 X162.38 Y70.73
+G1 X163.26 Y69.92
+G1 X164.23 Y69.22
+G1 X165.32 Y68.70
+M5
+G0 X113.15 Y113.09
+M3
+G1 X112.09 Y112.53
+G1 X111.03 Y111.98
+G1 X109.92 Y111.50
+G1 X108.75 Y111.26
+G1 X107.60 Y110.91
+G1 X106.42 Y110.70
+G1 X105.22 Y110.75
+G1 X104.07 Y111.07
+G1 X102.87 Y111.16
+G1 X101.67 Y111.23
+G1 X100.48 Y111.05
+G1 X99.37 Y110.62
+G1 X98.40 Y109.90
+G1 X97.32 Y109.38
+G1 X96.43 Y108.58
+G1 X95.40 Y107.96
+G1 X94.36 Y107.36
+G1 X93.25 Y106.89
+G1 X92.18 Y106.37
+G1 X91.00 Y106.11
+G1 X89.81 Y106.15
+G1 X88.61 Y106.23
+G1 X87.45 Y106.54
+G1 X86.25 Y106.53
+G1 X85.06 Y106.41
+G1 X83.88 Y106.16
+G1 X82.68 Y106.22
+G1 X81.48 Y106.21
+G1 X80.29 Y106.23
+G1 X79.11 Y106.47
+G1 X78.01 Y106.96
+G1 X76.88 Y107.36
+G1 X75.89 Y108.03
+G1 X74.86 Y108.64
+G1 X73.72 Y109.02
+G1 X72.55 Y109.29
+G1 X71.37 Y109.52
+G1 X70.27 Y110.00
+G1 X69.27 Y110.65
+G1 X68.44 Y111.52
+G1 X67.84 Y112.56
+G1 X67.58 Y113.73
+G1 X67.64 Y114.93
+G1 X67.66 Y116.13
+G1 X67.96 Y117.29
+G1 X68.29 Y118.45
+G1 X68.92 Y119.47
+G1 X69.29 Y120.61
+G1 X69.88 Y121.65
+G1 X70.58 Y122.63
+G1 X71.48 Y123.42
+G1 X72.11 Y124.44
+G1 X72.58 Y125.54
+G1 X73.35 Y126.47
+G1 X74.15 Y127.36
+G1 X74.76 Y128.40
+G1 X75.54 Y129.30
+G1 X76.48 Y130.05
+G1 X77.20 Y131.01
+G1 X77.63 Y132.13
+G1 X78.06 Y133.25
+G1 X78.32 Y134.42
+G1 X78.51 Y135.61
+G1 X78.45 Y136.80
+G1 X78.28 Y137.99
+G1 X77.98 Y139.15
+G1 X77.78 Y140.34
+G1 X77.38 Y141.47
+G1 X77.23 Y142.66
+G1 X77.17 Y143.86
+G1 X76.77 Y144.99
+G1 X76.10 Y145.98
+G1 X75.56 Y147.05
+G1 X75.24 Y148.21
+G1 X75.05 Y149.40
+G1 X74.81 Y150.57
+G1 X74.44 Y151.71
+G1 X74.14 Y152.88
+G1 X73.73 Y154.00
+G1 X73.07 Y155.00
+G1 X72.34 Y155.96
+G1 X71.42 Y156.73
+G1 X70.42 Y157.39
+G1 X69.43 Y158.08
+G1 X68.62 Y158.96
+G1 X67.62 Y159.62
+G1 X66.66 Y160.33
+G1 X65.78 Y161.15
+G1 X65.10 Y162.14
+G1 X64.56 Y163.22
+G1 X63.87 Y164.19
+G1 X62.95 Y164.97
+G1 X62.00 Y165.70
+G1 X60.99 Y166.34
+G1 X59.88 Y166.80
+G1 X58.85 Y167.42
+G1 X57.70 Y167.78
+G1 X56.55 Y168.11
+G1 X55.41 Y168.50
+G1 X54.45 Y169.21
+G1 X53.59 Y170.05
+G1 X52.74 Y170.89
+G1 X51.95 Y171.80
+G1 X51.08 Y172.62
+G1 X50.02 Y173.18
+G1 X49.03 Y173.86
+G1 X48.27 Y174.80
+G1 X47.58 Y175.77
+G1 X47.20 Y176.91
+G1 X46.97 Y178.09
+G1 X47.05 Y179.29
+G1 X47.38 Y180.44
+G1 X47.54 Y181.63
+G1 X47.94 Y182.76
+G1 X48.56 Y183.79
+G1 X49.12 Y184.85
+G1 X49.88 Y185.78
+G1 X50.57 Y186.76
+G1 X50.95 Y187.90
+M5
+G0 X176.50 Y141.88
+M3
+G1 X175.54 Y142.59
+G1 X174.51 Y143.21
+G1 X173.42 Y143.71
+G1 X172.27 Y144.05
+G1 X171.26 Y144.71
+G1 X170.47 Y145.61
+G1 X169.96 Y146.69
+G1 X169.52 Y147.81
+G1 X169.25 Y148.98
+G1 X168.68 Y150.03
+G1 X168.24 Y151.15
+G1 X167.54 Y152.13
+G1 X166.64 Y152.91
+G1 X165.80 Y153.77
+G1 X164.88 Y154.54
+G1 X164.11 Y155.47
+G1 X163.45 Y156.47
+G1 X162.57 Y157.28
+G1 X161.58 Y157.96
+G1 X160.57 Y158.61
+G1 X159.52 Y159.18
+G1 X158.45 Y159.74
+G1 X157.43 Y160.37
+G1 X156.50 Y161.13
+G1 X155.64 Y161.96
+G1 X154.57 Y162.51
+G1 X153.69 Y163.33
+G1 X152.86 Y164.19
+G1 X151.90 Y164.91
+G1 X151.18 Y165.87
+G1 X150.24 Y166.62
+G1 X149.20 Y167.22
+G1 X148.09 Y167.68
+G1 X147.01 Y168.20
+G1 X146.10 Y168.98
+G1 X145.14 Y169.70
+G1 X144.19 Y170.44
+G1 X143.44 Y171.37
+G1 X142.70 Y172.32
+G1 X142.17 Y173.39
+G1 X141.79 Y174.53
+G1 X141.20 Y175.57
+G1 X140.36 Y176.43
+G1 X139.63 Y177.39
+G1 X139.11 Y178.47
+G1 X138.77 Y179.62
+G1 X138.74 Y180.82
+G1 X138.56 Y182.00
+G1 X138.32 Y183.18
+G1 X137.95 Y184.32
+G1 X137.70 Y185.50
+G1 X137.42 Y186.66
+G1 X137.46 Y187.86
+G1 X137.52 Y189.06
+G1 X137.54 Y190.26
+G1 X137.66 Y191.45
+G1 X138.12 Y192.56
+G1 X138.43 Y193.72
+G1 X138.81 Y194.86
+G1 X139.41 Y195.90
+G1 X140.08 Y196.89
+G1 X140.76 Y197.88
+G1 X141.53 Y198.00
+G1 X142.47 Y198.00
+G1 X143.48 Y198.00
+G1 X144.54 Y198.00
+G1 X145.50 Y198.00
+G1 X146.29 Y198.00
+G1 X146.97 Y198.00
+G1 X147.69 Y198.00
+G1 X148.51 Y198.00
+G1 X149.07 Y198.00
+G1 X149.87 Y198.00
+G1 X150.83 Y198.00
+G1 X151.66 Y198.00
+G1 X152.46 Y198.00
+G1 X153.16 Y198.00
+G1 X154.12 Y198.00
+G1 X155.17 Y198.00
+G1 X156.17 Y198.00
+G1 X157.23 Y198.00
+G1 X158.19 Y198.00
+G1 X159.09 Y198.00
+G1 X159.84 Y198.00
+G1 X160.72 Y198.00
+G1 X161.59 Y198.00
+G1 X162.54 Y198.00
+G1 X163.28 Y198.00
+G1 X163.83 Y198.00
+G1 X164.27 Y198.00
+G1 X164.40 Y198.00
+G1 X164.62 Y198.00
+G1 X164.76 Y198.00
+G1 X164.95 Y198.00
+G1 X165.43 Y198.00
+G1 X166.13 Y198.00
+G1 X167.08 Y198.00
+G1 X168.06 Y198.00
+G1 X168.93 Y198.00
+G1 X169.72 Y198.00
+G1 X170.60 Y198.00
+G1 X171.25 Y198.00
+G1 X171.73 Y198.00
+G1 X171.99 Y198.00
+G1 X172.42 Y198.00
+G1 X172.92 Y198.00
+G1 X173.36 Y198.00
+G1 X173.71 Y198.00
+G1 X174.39 Y198.00
+G1 X174.90 Y198.00
+G1 X175.46 Y198.00
+G1 X176.17 Y198.00
+G1 X176.84 Y198.00
+G1 X177.62 Y198.00
+G1 X178.59 Y198.00
+G1 X179.71 Y198.00
+G1 X180.88 Y198.00
+G1 X182.05 Y198.00
+G1 X183.24 Y198.00
+M5
+G0 X116.30 Y30.80
+M3
+G1 X115.20 Y31.29
+G1 X114.14 Y31.84
+G1 X113.12 Y32.47
+G1 X112.13 Y33.16
+G1 X111.08 Y33.73
+G1 X110.05 Y34.35
+G1 X109.13 Y35.13
+G1 X108.12 Y35.77
+G1 X106.97 Y36.11
+G1 X105.78 Y36.26
+G1 X104.63 Y36.62
+G1 X103.48 Y36.95
+G1 X102.35 Y37.34
+G1 X101.15 Y37.49
+G1 X99.96 Y37.54
+G1 X98.77 Y37.37
+G1 X97.58 Y37.54
+G1 X96.44 Y37.92
+G1 X95.44 Y38.59
+G1 X94.63 Y39.47
+G1 X93.83 Y40.37
+G1 X92.96 Y41.19
+G1 X91.96 Y41.86
+G1 X90.87 Y42.35
+G1 X89.81 Y42.91
+G1 X88.75 Y43.48
+G1 X87.70 Y44.05
+G1 X86.61 Y44.55
+G1 X85.68 Y45.32
+G1 X84.92 Y46.24
+G1 X84.43 Y47.34
+G1 X84.17 Y48.51
+G1 X83.74 Y49.63
+G1 X83.32 Y50.75
+G1 X82.71 Y51.79
+G1 X81.99 Y52.75
+G1 X81.26 Y53.70
+G1 X80.68 Y54.75
+G1 X80.41 Y55.92
+G1 X79.95 Y57.03
+G1 X79.65 Y58.19
+G1 X79.45 Y59.37
+G1 X79.46 Y60.57
+G1 X79.50 Y61.77
+G1 X79.61 Y62.97
+G1 X79.60 Y64.17
+G1 X79.70 Y65.36
+G1 X79.86 Y66.55
+G1 X80.36 Y67.65
+G1 X81.15 Y68.55
+G1 X81.96 Y69.43
+G1 X82.92 Y70.15
+G1 X83.87 Y70.89
+G1 X84.80 Y71.64
+G1 X85.78 Y72.34
+G1 X86.66 Y73.16
+G1 X87.47 Y74.04
+G1 X88.33 Y74.87
+G1 X89.02 Y75.85
+G1 X89.71 Y76.84
+G1 X90.59 Y77.65
+G1 X91.43 Y78.52
+G1 X92.38 Y79.24
+G1 X93.30 Y80.01
+G1 X94.01 Y80.98
+G1 X94.70 Y81.96
+G1 X95.47 Y82.89
+G1 X96.16 Y83.87
+G1 X96.78 Y84.89
+G1 X97.47 Y85.88
+G1 X98.15 Y86.87
+G1 X98.76 Y87.90
+G1 X99.58 Y88.78
+G1 X100.19 Y89.81
+G1 X101.06 Y90.63
+G1 X101.73 Y91.63
+G1 X102.17 Y92.74
+G1 X102.68 Y93.83
+G1 X103.05 Y94.97
+G1 X103.12 Y96.17
+G1 X103.21 Y97.37
+G1 X103.39 Y98.55
+G1 X103.91 Y99.64
+G1 X104.68 Y100.55
+G1 X105.49 Y101.44
+G1 X106.10 Y102.47
+G1 X106.63 Y103.55
+G1 X106.88 Y104.72
+G1 X106.83 Y105.92
+G1 X106.48 Y107.07
+G1 X106.06 Y108.20
+G1 X105.36 Y109.17
+G1 X104.84 Y110.25
+G1 X104.05 Y111.15
+G1 X103.47 Y112.20
+G1 X102.72 Y113.13
+G1 X101.80 Y113.91
+G1 X100.85 Y114.65
+G1 X99.77 Y115.17
+G1 X98.63 Y115.53
+G1 X97.56 Y116.08
+G1 X96.54 Y116.71
+G1 X95.41 Y117.13
+G1 X94.26 Y117.44
+G1 X93.12 Y117.83
+G1 X91.92 Y117.90
+G1 X90.72 Y117.89
+G1 X89.55 Y118.13
+G1 X88.44 Y118.60
+G1 X87.30 Y118.95
+G1 X86.16 Y119.34
+G1 X85.12 Y119.93
+G1 X83.98 Y120.33
+G1 X82.91 Y120.86
+G1 X81.98 Y121.62
+G1 X80.93 Y122.21
+G1 X79.82 Y122.66
+G1 X78.85 Y123.36
+G1 X77.95 Y124.16
+M5
+G0 X128.55 Y170.58
+M3
+G1 X128.97 Y171.70
+G1 X129.65 Y172.69
+G1 X130.51 Y173.53
+G1 X131.28 Y174.45
+G1 X131.92 Y175.46
+G1 X132.63 Y176.43
+G1 X133.27 Y177.45
+G1 X133.67 Y178.57
+G1 X134.09 Y179.70
+G1 X134.29 Y180.88
+G1 X134.74 Y182.00
+G1 X135.47 Y182.95
+G1 X136.42 Y183.68
+G1 X137.45 Y184.31
+G1 X138.60 Y184.63
+G1 X139.64 Y185.24
+G1 X140.49 Y186.08
+G1 X141.48 Y186.76
+G1 X142.56 Y187.29
+G1 X143.69 Y187.71
+G1 X144.72 Y188.31
+G1 X145.59 Y189.14
+G1 X146.39 Y190.04
+G1 X147.38 Y190.71
+G1 X148.41 Y191.33
+G1 X149.33 Y192.10
+G1 X150.23 Y192.89
+G1 X151.26 Y193.50
+G1 X152.38 Y193.94
+G1 X153.35 Y194.64
+G1 X154.17 Y195.52
+G1 X154.79 Y196.55
+G1 X155.17 Y197.68
+G1 X155.27 Y198.00
+G1 X155.61 Y198.00
+G1 X156.09 Y198.00
+G1 X156.41 Y198.00
+G1 X156.82 Y198.00
+G1 X157.54 Y198.00
+G1 X158.05 Y198.00
+G1 X158.36 Y198.00
+G1 X158.60 Y198.00
+G1 X158.82 Y198.00
+G1 X158.86 Y198.00
+G1 X158.76 Y198.00
+G1 X158.41 Y198.00
+G1 X157.93 Y198.00
+G1 X157.62 Y198.00
+G1 X157.61 Y198.00
+G1 X157.83 Y198.00
+G1 X157.90 Y198.00
+G1 X157.66 Y198.00
+G1 X157.51 Y198.00
+G1 X157.63 Y198.00
+G1 X157.47 Y198.00
+G1 X157.31 Y198.00
+G1 X157.39 Y198.00
+G1 X157.38 Y198.00
+G1 X157.37 Y198.00
+G1 X157.22 Y198.00
+G1 X157.23 Y198.00
+G1 X157.29 Y198.00
+G1 X157.39 Y198.00
+G1 X157.71 Y198.00
+G1 X158.35 Y198.00
+G1 X158.82 Y198.00
+G1 X159.16 Y198.00
+G1 X159.78 Y198.00
+G1 X160.51 Y198.00
+G1 X161.48 Y198.00
+G1 X162.51 Y198.00
+G1 X163.65 Y198.00
+G1 X164.84 Y198.00
+G1 X166.01 Y198.00
+G1 X167.21 Y198.00
+G1 X168.34 Y198.00
+G1 X169.53 Y198.00
+G1 X170.69 Y198.00
+G1 X171.87 Y198.00
+G1 X173.05 Y198.00
+G1 X174.17 Y198.00
+G1 X175.26 Y198.00
+G1 X176.40 Y198.00
+G1 X177.57 Y198.00
+G1 X178.68 Y198.00
+G1 X179.66 Y198.00
+G1 X180.77 Y198.00
+G1 X181.73 Y198.00
+G1 X182.82 Y198.00
+G1 X183.74 Y198.00
+G1 X184.62 Y198.00
+G1 X185.40 Y198.00
+G1 X186.04 Y198.00
+G1 X186.71 Y198.00
+G1 X187.30 Y198.00
+G1 X187.68 Y198.00
+G1 X188.25 Y198.00
+G1 X188.74 Y198.00
+G1 X189.43 Y198.00
+G1 X189.99 Y198.00
+G1 X190.49 Y198.00
+G1 X190.84 Y198.00
+G1 X191.26 Y198.00
+G1 X191.84 Y198.00
+G1 X192.68 Y198.00
+G1 X193.55 Y198.00
+G1 X194.33 Y198.00
+G1 X195.17 Y198.00
+G1 X196.17 Y198.00
+G1 X197.05 Y198.00
+G1 X197.80 Y198.00
+G1 X198.00 Y198.00
+G1 X198.00 Y198.00
+G1 X198.00 Y198.00
+G1 X197.90 Y198.00
+G1 X197.81 Y198.00
+G1 X197.74 Y198.00
+G1 X197.88 Y198.00
+G1 X198.00 Y198.00
+M5
+G0 X130.61 Y143.82
+M3
+G1 X129.50 Y143.35
+G1 X128.41 Y142.86
+G1 X127.32 Y142.36
+G1 X126.21 Y141.90
+G1 X125.09 Y141.47
+G1 X124.04 Y140.89
+G1 X123.20 Y140.03
+G1 X122.26 Y139.29
+G1 X121.46 Y138.39
+G1 X120.53 Y137.63
+G1 X119.67 Y136.80
+G1 X118.92 Y135.86
+G1 X118.38 Y134.79
+G1 X117.81 Y133.73
+G1 X117.18 Y132.71
+G1 X116.38 Y131.81
+G1 X115.58 Y130.92
+G1 X115.04 Y129.85
+G1 X114.33 Y128.88
+G1 X113.49 Y128.03
+G1 X112.84 Y127.02
+G1 X112.34 Y125.93
+G1 X111.63 Y124.96
+G1 X110.81 Y124.08
+G1 X109.96 Y123.23
+G1 X109.18 Y122.33
+G1 X108.69 Y121.23
+G1 X107.94 Y120.29
+G1 X107.47 Y119.19
+G1 X106.98 Y118.10
+G1 X106.41 Y117.04
+G1 X105.79 Y116.01
+G1 X105.04 Y115.07
+G1 X104.19 Y114.23
+G1 X103.54 Y113.22
+G1 X102.84 Y112.24
+G1 X102.19 Y111.23
+G1 X101.29 Y110.45
+G1 X100.38 Y109.66
+G1 X99.61 Y108.74
+G1 X99.07 Y107.67
+G1 X98.67 Y106.54
+G1 X98.23 Y105.42
+G1 X97.56 Y104.42
+G1 X96.87 Y103.45
+G1 X96.35 Y102.36
+G1 X96.09 Y101.19
+G1 X95.57 Y100.11
+G1 X95.13 Y98.99
+G1 X94.47 Y97.99
+G1 X93.74 Y97.04
+G1 X92.93 Y96.16
+G1 X92.33 Y95.12
+G1 X91.71 Y94.09
+G1 X91.14 Y93.04
+G1 X90.73 Y91.91
+G1 X90.10 Y90.89
+G1 X89.25 Y90.04
+G1 X88.42 Y89.18
+G1 X87.85 Y88.12
+G1 X87.15 Y87.15
+G1 X86.33 Y86.27
+G1 X85.42 Y85.48
+G1 X84.63 Y84.58
+G1 X83.91 Y83.62
+G1 X83.30 Y82.59
+G1 X82.66 Y81.57
+G1 X81.80 Y80.73
+G1 X80.79 Y80.10
+G1 X79.66 Y79.67
+G1 X78.48 Y79.49
+G1 X77.28 Y79.40
+G1 X76.09 Y79.26
+G1 X74.90 Y79.43
+G1 X73.81 Y79.94
+G1 X72.89 Y80.71
+G1 X72.15 Y81.65
+G1 X71.22 Y82.41
+G1 X70.44 Y83.32
+G1 X69.48 Y84.04
+G1 X68.76 Y85.01
+G1 X68.14 Y86.03
+G1 X67.82 Y87.19
+G1 X67.76 Y88.38
+G1 X67.90 Y89.58
+G1 X67.87 Y90.78
+G1 X67.49 Y91.92
+G1 X67.07 Y93.04
+G1 X66.89 Y94.22
+G1 X66.59 Y95.39
+G1 X66.28 Y96.54
+G1 X65.78 Y97.64
+G1 X64.98 Y98.54
+G1 X64.28 Y99.51
+G1 X63.60 Y100.49
+G1 X62.79 Y101.39
+G1 X61.82 Y102.09
+G1 X60.74 Y102.61
+G1 X59.79 Y103.34
+G1 X58.78 Y103.99
+G1 X57.68 Y104.48
+G1 X56.51 Y104.75
+G1 X55.32 Y104.83
+G1 X54.12 Y104.70
+G1 X52.92 Y104.65
+G1 X51.78 Y104.31
+G1 X50.66 Y103.85
+G1 X49.59 Y103.31
+G1 X48.69 Y102.52
+G1 X47.81 Y101.71
+G1 X47.12 Y100.72
+G1 X46.22 Y99.93
+G1 X45.29 Y99.18
+G1 X44.20 Y98.67
+G1 X43.12 Y98.14
+G1 X42.23 Y97.33
+G1 X41.45 Y96.43
+G1 X40.89 Y95.36
+G1 X40.45 Y94.25
+M5
+G0 X127.69 Y105.12
+M3
+G1 X126.88 Y105.99
+G1 X126.02 Y106.83
+G1 X125.08 Y107.58
+G1 X124.26 Y108.45
+G1 X123.28 Y109.16
+G1 X122.37 Y109.93
+G1 X121.37 Y110.60
+G1 X120.39 Y111.30
+G1 X119.36 Y111.90
+G1 X118.30 Y112.48
+G1 X117.43 Y113.30
+G1 X116.36 Y113.84
+G1 X115.38 Y114.53
+G1 X114.24 Y114.91
+G1 X113.11 Y115.31
+G1 X112.13 Y116.00
+G1 X111.01 Y116.43
+G1 X109.97 Y117.03
+G1 X109.13 Y117.89
+G1 X108.34 Y118.79
+G1 X107.33 Y119.43
+G1 X106.35 Y120.13
+G1 X105.27 Y120.64
+G1 X104.18 Y121.14
+G1 X103.19 Y121.82
+G1 X102.33 Y122.66
+G1 X101.31 Y123.30
+G1 X100.42 Y124.10
+G1 X99.72 Y125.07
+G1 X99.33 Y126.21
+G1 X98.78 Y127.28
+G1 X97.99 Y128.17
+G1 X97.18 Y129.07
+G1 X96.63 Y130.13
+G1 X96.10 Y131.20
+G1 X95.54 Y132.27
+G1 X95.18 Y133.41
+G1 X94.83 Y134.56
+G1 X94.45 Y135.70
+G1 X94.32 Y136.89
+G1 X94.49 Y138.08
+G1 X94.54 Y139.28
+G1 X94.29 Y140.45
+G1 X93.74 Y141.52
+G1 X93.47 Y142.69
+G1 X93.31 Y143.88
+G1 X93.50 Y145.06
+G1 X93.71 Y146.24
+G1 X93.59 Y147.44
+G1 X93.44 Y148.63
+G1 X93.42 Y149.83
+G1 X93.71 Y150.99
+G1 X94.07 Y152.14
+G1 X94.09 Y153.34
+G1 X93.79 Y154.50
+G1 X93.23 Y155.56
+G1 X92.99 Y156.74
+G1 X92.68 Y157.89
+G1 X92.35 Y159.05
+G1 X92.22 Y160.24
+G1 X92.21 Y161.44
+G1 X92.44 Y162.62
+G1 X92.54 Y163.81
+G1 X92.96 Y164.94
+G1 X93.35 Y166.07
+G1 X93.70 Y167.22
+G1 X94.10 Y168.35
+G1 X94.31 Y169.53
+G1 X94.35 Y170.73
+G1 X94.48 Y171.93
+G1 X94.31 Y173.11
+G1 X93.95 Y174.26
+G1 X93.59 Y175.40
+G1 X93.28 Y176.56
+G1 X92.96 Y177.72
+G1 X92.87 Y178.92
+G1 X92.43 Y180.03
+G1 X92.15 Y181.20
+G1 X91.61 Y182.27
+G1 X91.33 Y183.44
+G1 X91.23 Y184.63
+G1 X91.18 Y185.83
+G1 X91.44 Y187.01
+G1 X91.67 Y188.18
+G1 X91.73 Y189.38
+G1 X91.94 Y190.56
+G1 X92.45 Y191.65
+G1 X93.14 Y192.63
+G1 X93.86 Y193.59
+G1 X94.51 Y194.60
+G1 X95.28 Y195.52
+G1 X96.09 Y196.41
+G1 X97.02 Y197.16
+G1 X97.78 Y198.00
+G1 X98.57 Y198.00
+G1 X99.51 Y198.00
+G1 X100.63 Y198.00
+G1 X101.65 Y198.00
+G1 X102.74 Y198.00
+G1 X103.83 Y198.00
+G1 X104.98 Y198.00
+G1 X106.04 Y198.00
+G1 X106.88 Y198.00
+G1 X107.78 Y198.00
+G1 X108.74 Y198.00
+G1 X109.62 Y198.00
+G1 X110.33 Y198.00
+G1 X111.07 Y198.00
+G1 X111.99 Y198.00
+G1 X113.03 Y198.00
+G1 X114.06 Y198.00
+G1 X115.05 Y198.00
+G1 X115.92 Y198.00
+G1 X116.92 Y198.00
+G1 X117.79 Y198.00
+G1 X118.74 Y198.00
+G1 X119.86 Y198.00
+G1 X120.92 Y198.00
+G1 X121.96 Y198.00
+M5
+G0 X161.86 Y75.99
+M3
+G1 X162.38 Y77.07
+G1 X162.95 Y78.13
+G1 X163.62 Y79.13
+G1 X164.39 Y80.05
+G1 X164.89 Y81.14
+G1 X165.39 Y82.23
+G1 X165.91 Y83.31
+G1 X166.43 Y84.39
+G1 X166.99 Y85.45
+G1 X167.39 Y86.58
+G1 X167.52 Y87.78
+G1 X167.86 Y88.93
+G1 X168.45 Y89.97
+G1 X169.29 Y90.82
+G1 X170.32 Y91.45
+G1 X171.33 Y92.10
+G1 X172.42 Y92.60
+G1 X173.59 Y92.87
+G1 X174.78 Y93.01
+G1 X175.96 Y92.80
+G1 X177.08 Y92.36
+G1 X178.25 Y92.11
+G1 X179.45 Y92.05
+G1 X180.63 Y91.81
+G1 X181.75 Y91.40
+G1 X182.75 Y90.73
+G1 X183.76 Y90.08
+G1 X184.77 Y89.44
+G1 X185.78 Y88.79
+G1 X186.76 Y88.09
+G1 X187.63 Y87.27
+G1 X188.61 Y86.57
+G1 X189.61 Y85.90
+G1 X190.51 Y85.12
+G1 X191.56 Y84.53
+G1 X192.51 Y83.80
+G1 X193.42 Y83.02
+G1 X194.42 Y82.36
+G1 X195.40 Y81.65
+G1 X196.46 Y81.09
+G1 X197.58 Y80.68
+G1 X198.00 Y79.95
+G1 X198.00 Y79.36
+G1 X198.00 Y79.00
+G1 X198.00 Y78.51
+G1 X198.00 Y77.94
+G1 X198.00 Y77.66
+G1 X198.00 Y77.12
+G1 X198.00 Y76.89
+G1 X198.00 Y76.83
+G1 X198.00 Y76.97
+G1 X198.00 Y76.88
+G1 X198.00 Y77.14
+G1 X198.00 Y77.39
+G1 X198.00 Y77.67
+G1 X198.00 Y77.74
+G1 X198.00 Y77.99
+G1 X198.00 Y78.48
+G1 X198.00 Y78.70
+G1 X198.00 Y79.12
+G1 X198.00 Y79.74
+G1 X198.00 Y80.09
+G1 X198.00 Y80.32
+G1 X198.00 Y80.21
+G1 X198.00 Y80.13
+G1 X198.00 Y80.22
+G1 X198.00 Y80.54
+G1 X198.00 Y80.66
+G1 X198.00 Y80.75
+G1 X198.00 Y80.80
+G1 X198.00 Y80.82
+G1 X198.00 Y81.18
+G1 X198.00 Y81.18
+G1 X198.00 Y81.19
+G1 X198.00 Y81.39
+G1 X198.00 Y81.90
+G1 X198.00 Y82.24
+G1 X198.00 Y82.76
+G1 X198.00 Y83.23
+G1 X198.00 Y83.85
+G1 X198.00 Y84.40
+G1 X198.00 Y85.13
+G1 X198.00 Y85.57
+G1 X198.00 Y86.13
+G1 X198.00 Y86.39
+G1 X198.00 Y86.81
+G1 X198.00 Y87.33
+G1 X198.00 Y87.67
+G1 X198.00 Y88.26
+G1 X198.00 Y89.11
+G1 X198.00 Y90.18
+G1 X198.00 Y91.33
+G1 X198.00 Y92.53
+G1 X198.00 Y93.68
+G1 X198.00 Y94.76
+G1 X198.00 Y95.90
+G1 X198.00 Y97.09
+G1 X198.00 Y98.27
+G1 X198.00 Y99.41
+G1 X198.00 Y100.59
+G1 X198.00 Y101.78
+G1 X198.00 Y102.97
+G1 X198.00 Y104.17
+G1 X198.00 Y105.33
+G1 X198.00 Y106.52
+G1 X198.00 Y107.71
+G1 X198.00 Y108.88
+G1 X198.00 Y109.91
+G1 X198.00 Y111.02
+G1 X198.00 Y112.19
+G1 X198.00 Y113.36
+G1 X198.00 Y114.53
+G1 X198.00 Y115.64
+G1 X198.00 Y116.83
+G1 X197.85 Y118.02
+G1 X197.87 Y119.22
+G1 X197.63 Y120.39
+G1 X197.30 Y121.55
+G1 X196.89 Y122.67
+M5
+G0 X130.27 Y65.23
+M3
+G1 X129.36 Y66.01
+G1 X128.26 Y66.49
+G1 X127.20 Y67.05
+G1 X126.22 Y67.75
+G1 X125.49 Y68.70
+G1 X124.79 Y69.67
+G1 X123.87 Y70.44
+G1 X123.00 Y71.26
+G1 X122.12 Y72.08
+G1 X121.05 Y72.63
+G1 X119.94 Y73.08
+G1 X118.89 Y73.66
+G1 X117.88 Y74.32
+G1 X117.02 Y75.15
+G1 X116.07 Y75.88
+G1 X115.10 Y76.59
+G1 X114.16 Y77.33
+G1 X113.35 Y78.22
+G1 X112.72 Y79.24
+G1 X111.93 Y80.15
+G1 X111.43 Y81.24
+G1 X110.76 Y82.23
+G1 X110.38 Y83.37
+G1 X110.08 Y84.53
+G1 X109.93 Y85.72
+G1 X109.78 Y86.91
+G1 X109.52 Y88.08
+G1 X108.96 Y89.14
+G1 X108.24 Y90.10
+G1 X107.59 Y91.11
+G1 X107.18 Y92.24
+G1 X106.97 Y93.42
+G1 X106.50 Y94.52
+G1 X105.84 Y95.53
+G1 X105.15 Y96.51
+G1 X104.77 Y97.65
+G1 X104.11 Y98.65
+G1 X103.57 Y99.72
+G1 X102.80 Y100.64
+G1 X101.92 Y101.46
+G1 X100.96 Y102.17
+G1 X99.83 Y102.59
+G1 X98.68 Y102.94
+G1 X97.50 Y103.11
+G1 X96.30 Y103.11
+G1 X95.12 Y103.35
+G1 X93.98 Y103.72
+G1 X92.79 Y103.90
+G1 X91.64 Y104.25
+G1 X90.52 Y104.68
+G1 X89.41 Y105.13
+G1 X88.27 Y105.49
+G1 X87.07 Y105.55
+G1 X85.87 Y105.59
+G1 X84.68 Y105.46
+G1 X83.49 Y105.62
+G1 X82.32 Y105.91
+G1 X81.25 Y106.44
+G1 X80.15 Y106.93
+G1 X79.00 Y107.28
+G1 X77.91 Y107.77
+G1 X76.77 Y108.14
+G1 X75.60 Y108.43
+G1 X74.41 Y108.59
+G1 X73.31 Y109.06
+G1 X72.26 Y109.63
+G1 X71.20 Y110.20
+G1 X70.35 Y111.04
+G1 X69.58 Y111.97
+G1 X68.64 Y112.71
+G1 X67.60 Y113.30
+G1 X66.77 Y114.17
+G1 X66.05 Y115.13
+G1 X65.28 Y116.05
+G1 X64.41 Y116.88
+G1 X63.69 Y117.84
+G1 X63.05 Y118.86
+G1 X62.22 Y119.72
+G1 X61.64 Y120.78
+G1 X60.81 Y121.64
+G1 X59.78 Y122.26
+G1 X58.74 Y122.85
+G1 X57.73 Y123.50
+G1 X56.88 Y124.35
+G1 X55.94 Y125.09
+G1 X54.90 Y125.69
+G1 X53.78 Y126.12
+G1 X52.61 Y126.39
+G1 X51.51 Y126.89
+G1 X50.60 Y127.66
+G1 X49.50 Y128.15
+G1 X48.35 Y128.50
+G1 X47.18 Y128.75
+G1 X45.98 Y128.84
+G1 X44.78 Y128.82
+G1 X43.63 Y128.51
+G1 X42.59 Y127.90
+G1 X41.59 Y127.24
+G1 X40.74 Y126.40
+G1 X40.09 Y125.39
+G1 X39.67 Y124.26
+G1 X39.55 Y123.07
+G1 X39.55 Y121.87
+G1 X39.72 Y120.68
+G1 X39.78 Y119.48
+G1 X40.03 Y118.31
+G1 X40.16 Y117.12
+G1 X40.53 Y115.98
+G1 X40.97 Y114.86
+G1 X41.39 Y113.73
+G1 X41.66 Y112.56
+G1 X41.62 Y111.37
+G1 X41.89 Y110.20
+G1 X42.09 Y109.01
+G1 X42.15 Y107.81
+G1 X42.41 Y106.64
+G1 X42.44 Y105.44
+G1 X42.14 Y104.28
+G1 X41.56 Y103.23
+M5
+G0 X158.16 Y80.33
+M3
+G1 X158.73 Y79.27
+G1 X159.39 Y78.27
+G1 X159.94 Y77.21
+G1 X160.37 Y76.09
+G1 X160.87 Y75.00
+G1 X161.19 Y73.84
+G1 X161.72 Y72.76
+G1 X162.46 Y71.82
+G1 X163.36 Y71.02
+G1 X164.30 Y70.28
+G1 X165.35 Y69.70
+G1 X166.25 Y68.90
+G1 X167.26 Y68.26
+G1 X168.34 Y67.73
+G1 X169.42 Y67.21
+G1 X170.55 Y66.80
+G1 X171.65 Y66.34
+G1 X172.62 Y65.62
+G1 X173.71 Y65.13
+G1 X174.90 Y64.98
+G1 X176.03 Y64.56
+G1 X177.18 Y64.22
+G1 X178.19 Y63.59
+G1 X179.20 Y62.93
+G1 X180.32 Y62.51
+G1 X181.34 Y61.87
+G1 X182.28 Y61.12
+G1 X182.97 Y60.14
+G1 X183.45 Y59.04
+G1 X184.13 Y58.05
+G1 X184.98 Y57.20
+G1 X185.68 Y56.23
+G1 X186.61 Y55.47
+G1 X187.52 Y54.68
+G1 X188.58 Y54.13
+G1 X189.68 Y53.65
+G1 X190.71 Y53.04
+G1 X191.77 Y52.47
+G1 X192.89 Y52.05
+G1 X194.03 Y51.67
+G1 X195.22 Y51.49
+G1 X196.31 Y51.00
+G1 X197.38 Y50.45
+G1 X198.00 Y49.77
+G1 X198.00 Y49.16
+G1 X198.00 Y48.50
+G1 X198.00 Y47.91
+G1 X198.00 Y47.25
+G1 X198.00 Y46.73
+G1 X198.00 Y46.21
+G1 X198.00 Y45.44
+G1 X198.00 Y44.50
+G1 X198.00 Y43.50
+G1 X198.00 Y42.51
+G1 X198.00 Y41.74
+G1 X198.00 Y40.84
+G1 X198.00 Y40.19
+G1 X198.00 Y39.49
+G1 X198.00 Y38.63
+G1 X198.00 Y37.68
+G1 X198.00 Y36.73
+G1 X198.00 Y35.76
+G1 X198.00 Y34.63
+G1 X198.00 Y33.44
+G1 X198.00 Y32.25
+G1 X198.00 Y31.08
+G1 X198.00 Y29.88
+G1 X198.00 Y28.73
+G1 X198.00 Y27.54
+G1 X198.00 Y26.38
+G1 X198.00 Y25.25
+G1 X198.00 Y24.09
+G1 X198.00 Y22.89
+G1 X198.00 Y21.75
+G1 X198.00 Y20.63
+G1 X198.00 Y19.44
+G1 X197.84 Y18.25
+G1 X197.70 Y17.06
+G1 X197.66 Y15.86
+G1 X197.49 Y14.67
+G1 X197.33 Y13.48
+G1 X197.29 Y12.28
+G1 X197.38 Y11.09
+G1 X197.22 Y9.90
+G1 X197.01 Y8.72
+G1 X196.94 Y7.52
+G1 X196.90 Y6.32
+G1 X196.91 Y5.12
+G1 X196.96 Y3.92
+G1 X196.87 Y2.72
+G1 X196.73 Y2.00
+G1 X196.59 Y2.00
+G1 X196.43 Y2.00
+G1 X196.04 Y2.00
+G1 X195.97 Y2.00
+G1 X195.66 Y2.00
+G1 X195.70 Y2.00
+G1 X195.85 Y2.00
+G1 X196.28 Y2.00
+G1 X196.50 Y2.00
+G1 X196.61 Y2.00
+G1 X196.73 Y2.00
+G1 X197.14 Y2.00
+G1 X197.75 Y2.00
+G1 X198.00 Y2.00
+G1 X198.00 Y2.00
+G1 X198.00 Y2.00
+G1 X198.00 Y2.00
+G1 X198.00 Y2.00
+G1 X198.00 Y2.00
+G1 X198.00 Y2.00
+G1 X198.00 Y2.00
+G1 X198.00 Y2.00
+G1 X198.00 Y2.00
+G1 X198.00 Y2.00
+G1 X198.00 Y2.00
+G1 X198.00 Y2.00
+G1 X198.00 Y2.00
+G1 X198.00 Y2.00
+M5
+M5
+G28
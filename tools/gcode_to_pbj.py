@@ -0,0 +1,141 @@
+#!/usr/bin/env python3
+"""
+Convert PlotterBot G-code to the compact binary job format (.pbj).
+
+Usage:
+    python3 tools/gcode_to_pbj.py drawing.gcode drawing.pbj
+    curl --data-binary @drawing.pbj http://plotter.local/api/job/binary
+
+Supports what the web interface generates: G0, G1, G28, G90, M3, M5, F
+feed rates and comments. The format is described in plotter_sketch/src/binary_job.h.
+"""
+
+import argparse
+import re
+import struct
+import sys
+
+VERSION = 2
+OP_END = 0x00
+OP_PEN_UP = 0x01
+OP_PEN_DOWN = 0x02
+OP_HOME = 0x03
+OP_MOVE = 0x04
+OP_FEED = 0x05
+
+WORD = re.compile(r"([A-Za-z])\s*([-+]?(?:\d+\.?\d*|\.\d+))")
+
+
+def varint(value):
+    """Zigzag-encode a signed integer as a varint."""
+    raw = (value << 1) ^ (value >> 31)
+    raw &= 0xFFFFFFFF
+    out = bytearray()
+    while raw >= 0x80:
+        out.append((raw & 0x7F) | 0x80)
+        raw >>= 7
+    out.append(raw)
+    return out
+
+
+def parse_words(line):
+    line = re.sub(r"\(.*?\)", "", line.split(";", 1)[0])
+    return {letter.upper(): float(value) for letter, value in WORD.findall(line)}
+
+
+def convert(gcode, units_per_mm):
+    out = bytearray(b"PBJ" + struct.pack("<BHH", VERSION, units_per_mm, 0))
+    x = y = 0          # Position in units
+    pen_down = None    # Unknown until the first pen command
+    feed = 0           # Units per minute, 0 until the first F
+
+    def pen(down):
+        nonlocal pen_down
+        if pen_down != down:
+            out.append(OP_PEN_DOWN if down else OP_PEN_UP)
+            pen_down = down
+
+    def set_feed(value):
+        nonlocal feed
+        units = round(value * units_per_mm)
+        if units != feed:
+            out.append(OP_FEED)
+            out.extend(varint(units))
+            feed = units
+
+    def move(words):
+        nonlocal x, y
+        nx = round(words["X"] * units_per_mm) if "X" in words else x
+        ny = round(words["Y"] * units_per_mm) if "Y" in words else y
+        if (nx, ny) != (x, y):
+            out.append(OP_MOVE)
+            out.extend(varint(nx - x))
+            out.extend(varint(ny - y))
+            x, y = nx, ny
+
+    for number, line in enumerate(gcode.splitlines(), 1):
+        words = parse_words(line)
+        if not words:
+            continue
+        if "Z" in words:
+            raise ValueError(f"line {number}: Z moves are not supported: {line.strip()}")
+        if "F" in words:
+            if words["F"] <= 0:
+                raise ValueError(f"line {number}: invalid feed rate: {line.strip()}")
+            set_feed(words["F"])
+
+        if "G" in words:
+            code = int(words["G"])
+            if code == 0:
+                pen(False)
+                move(words)
+            elif code == 1:
+                pen(True)
+                move(words)
+            elif code == 28:
+                out.append(OP_HOME)
+                x = y = 0
+                pen_down = False
+            elif code == 90:
+                pass
+            else:
+                raise ValueError(f"line {number}: unsupported command: {line.strip()}")
+        elif "M" in words:
+            code = int(words["M"])
+            if code == 3:
+                pen(True)
+            elif code == 5:
+                pen(False)
+            elif code not in (18, 84, 114):
+                raise ValueError(f"line {number}: unsupported command: {line.strip()}")
+        elif set(words) != {"F"}:
+            raise ValueError(f"line {number}: unsupported line: {line.strip()}")
+
+    out.append(OP_END)
+    return bytes(out)
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.strip().splitlines()[0])
+    parser.add_argument("input", help="G-code file")
+    parser.add_argument("output", help="binary job file to write")
+    parser.add_argument("--units", type=int, default=100,
+                        help="coordinate units per mm (default 100 = 0.01 mm)")
+    args = parser.parse_args()
+
+    with open(args.input) as f:
+        gcode = f.read()
+    try:
+        data = convert(gcode, args.units)
+    except ValueError as error:
+        sys.exit(f"error: {error}")
+
+    with open(args.output, "wb") as f:
+        f.write(data)
+
+    size_in = len(gcode.encode())
+    print(f"{size_in} -> {len(data)} bytes ({size_in / len(data):.1f}x smaller)")
+
+
+if __name__ == "__main__":
+    main()
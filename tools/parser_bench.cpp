@@ -0,0 +1,220 @@
+/*
+ * Host benchmark of the G-code tokenizer against the String-based parser
+ * it replaced.
+ *
+ * Usage:
+ *     g++ -std=gnu++17 -O2 -o parser_bench tools/parser_bench.cpp
+ *     ./parser_bench tools/bench/label_sheet.gcode
+ *
+ * Each line of the job is parsed the way executeGCode() used to parse it
+ * (trim(), toUpperCase(), a substring() for the command and for each
+ * X/Y/Z word, toFloat()) and then with parseGCodeLine() from
+ * plotter_sketch/src/gcode_tokenizer.h. Only the parsing is timed, not the
+ * moves. The job is parsed repeatedly until about a second has passed.
+ *
+ * LegacyString copies the way Arduino-ESP32's String does: strings of up
+ * to 11 characters live inline, and longer ones take a heap allocation.
+ * Allocations are counted through the global operator new.
+ *
+ * tools/bench/label_sheet.gcode is what the web UI generates for a sheet
+ * of text labels and some freehand strokes.
+ */
+
+#include <chrono>
+#include <cctype>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <new>
+#include <string>
+#include <vector>
+
+#include "../plotter_sketch/src/gcode_tokenizer.h"
+
+static size_t heapAllocations = 0;
+
+void* operator new(size_t size) {
+  heapAllocations++;
+  void* p = malloc(size);
+  if (p == NULL) throw std::bad_alloc();
+  return p;
+}
+
+void operator delete(void* p) noexcept { free(p); }
+void operator delete(void* p, size_t) noexcept { free(p); }
+void* operator new[](size_t size) { return operator new(size); }
+void operator delete[](void* p) noexcept { free(p); }
+void operator delete[](void* p, size_t) noexcept { free(p); }
+
+/**
+ * The parts of Arduino's String the old parser used
+ */
+class LegacyString {
+ public:
+  static const size_t INLINE_MAX = 11;    // Arduino-ESP32 SSO capacity on a 32-bit target
+
+  LegacyString(const char* text, size_t length) { assign(text, length); }
+  LegacyString(const LegacyString& other) { assign(other.c_str(), other.len); }
+  ~LegacyString() { release(); }
+
+  LegacyString& operator=(const LegacyString& other) {
+    if (this != &other) {
+      release();
+      assign(other.c_str(), other.len);
+    }
+    return *this;
+  }
+
+  const char* c_str() const { return heap != NULL ? heap : local; }
+  size_t length() const { return len; }
+
+  void trim() {
+    char* s = buffer();
+    size_t begin = 0;
+    size_t end = len;
+    while (begin < end && isspace((unsigned char)s[begin])) begin++;
+    while (end > begin && isspace((unsigned char)s[end - 1])) end--;
+    memmove(s, s + begin, end - begin);
+    len = end - begin;
+    s[len] = '\0';
+  }
+
+  void toUpperCase() {
+    char* s = buffer();
+    for (size_t i = 0; i < len; i++) s[i] = toupper((unsigned char)s[i]);
+  }
+
+  bool startsWith(const char* prefix) const { return strncmp(c_str(), prefix, strlen(prefix)) == 0; }
+
+  int indexOf(char c) const {
+    const char* found = (const char*)memchr(c_str(), c, len);
+    return found != NULL ? (int)(found - c_str()) : -1;
+  }
+
+  LegacyString substring(size_t begin, size_t end) const { return LegacyString(c_str() + begin, end - begin); }
+  LegacyString substring(size_t begin) const { return substring(begin, len); }
+  float toFloat() const { return atof(c_str()); }
+  bool operator==(const char* other) const { return strcmp(c_str(), other) == 0; }
+
+ private:
+  char local[INLINE_MAX + 1];
+  char* heap = NULL;
+  size_t len = 0;
+
+  char* buffer() { return heap != NULL ? heap : local; }
+
+  void assign(const char* text, size_t length) {
+    len = length;
+    if (length > INLINE_MAX) heap = new char[length + 1];
+    memcpy(buffer(), text, length);
+    buffer()[length] = '\0';
+  }
+
+  void release() {
+    delete[] heap;
+    heap = NULL;
+  }
+};
+
+volatile float sink;
+
+/**
+ * The parsing half of the old executeGCode(String line)
+ */
+bool legacyParse(LegacyString line) {
+  line.trim();
+  line.toUpperCase();
+  if (line.length() == 0 || line.startsWith(";") || line.startsWith("(")) return true;
+
+  LegacyString command("", 0);
+  int spaceIndex = line.indexOf(' ');
+  if (spaceIndex > 0) {
+    command = line.substring(0, spaceIndex);
+  } else {
+    command = line;
+  }
+
+  int xIndex = line.indexOf('X');
+  if (xIndex >= 0) sink = sink + line.substring(xIndex + 1).toFloat();
+  int yIndex = line.indexOf('Y');
+  if (yIndex >= 0) sink = sink + line.substring(yIndex + 1).toFloat();
+  int zIndex = line.indexOf('Z');
+  if (zIndex >= 0) sink = sink + line.substring(zIndex + 1).toFloat();
+
+  return command == "G0" || command == "G1" || command == "M3" || command == "M5";
+}
+
+bool tokenizerParse(const char* line) {
+  GCodeBlock block;
+  if (!parseGCodeLine(line, &block)) return false;
+  if (hasWord(&block, 'X')) sink = sink + wordValue(&block, 'X');
+  if (hasWord(&block, 'Y')) sink = sink + wordValue(&block, 'Y');
+  if (hasWord(&block, 'Z')) sink = sink + wordValue(&block, 'Z');
+  return true;
+}
+
+struct Result {
+  double nsPerLine;
+  double allocationsPerLine;
+};
+
+/**
+ * Parse the job with parse() until about a second has passed
+ */
+template <typename Parse>
+Result measure(const std::vector<std::string>& lines, Parse parse) {
+  using Clock = std::chrono::steady_clock;
+  size_t parsed = 0;
+  size_t allocations = 0;
+  double elapsedNs = 0;
+
+  while (elapsedNs < 1e9) {
+    size_t before = heapAllocations;
+    Clock::time_point start = Clock::now();
+    for (const std::string& line : lines) parse(line);
+    elapsedNs += std::chrono::duration<double, std::nano>(Clock::now() - start).count();
+    allocations += heapAllocations - before;
+    parsed += lines.size();
+  }
+  return {elapsedNs / parsed, (double)allocations / parsed};
+}
+
+int main(int argc, char** argv) {
+  if (argc != 2) {
+    fprintf(stderr, "usage: %s job.gcode\n", argv[0]);
+    return 2;
+  }
+
+  FILE* file = fopen(argv[1], "r");
+  if (file == NULL) {
+    perror(argv[1]);
+    return 1;
+  }
+  std::vector<std::string> lines;
+  size_t bytes = 0;
+  char buffer[256];
+  while (fgets(buffer, sizeof(buffer), file) != NULL) {
+    size_t length = strcspn(buffer, "\r\n");
+    lines.emplace_back(buffer, length);
+    bytes += strlen(buffer);
+  }
+  fclose(file);
+  if (lines.empty()) {
+    fprintf(stderr, "%s: no lines\n", argv[1]);
+    return 1;
+  }
+
+  printf("%s: %zu lines, %zu bytes\n", argv[1], lines.size(), bytes);
+
+  Result legacy = measure(lines, [](const std::string& line) {
+    return legacyParse(LegacyString(line.c_str(), line.size()));
+  });
+  Result tokenizer = measure(lines, [](const std::string& line) { return tokenizerParse(line.c_str()); });
+
+  printf("  String parser  %8.1f ns/line  %5.2f heap allocations/line\n", legacy.nsPerLine,
+         legacy.allocationsPerLine);
+  printf("  tokenizer      %8.1f ns/line  %5.2f heap allocations/line\n", tokenizer.nsPerLine,
+         tokenizer.allocationsPerLine);
+  printf("  speedup        %8.1fx\n", legacy.nsPerLine / tokenizer.nsPerLine);
+  return 0;
+}
@@ -0,0 +1,169 @@
+#!/usr/bin/env python3
+"""
+Decode a PlotterBot step-timing trace (/api/trace).
+
+Usage:
+    curl -X POST 'http://plotter.local/api/trace?mode=underrun&events=8192'
+    curl -o trace.bin http://plotter.local/api/trace
+    python3 tools/trace_decode.py trace.bin
+
+Prints the step-interval and jitter histograms, the worst late ticks and
+every underrun (the segment buffer running dry while moves were still
+queued). The format is described in plotter_sketch/src/trace.h.
+"""
+
+import argparse
+import struct
+import sys
+
+MAGIC = b"PTRC"
+VERSION = 1
+HEADER = struct.Struct("<4sBBHII")
+EVENT = struct.Struct("<IBBH")
+
+TRACE_STEP = 1
+TRACE_SEGMENT = 2
+TRACE_UNDERRUN = 3
+TRACE_IDLE = 4
+TYPE_NAMES = {TRACE_STEP: "step", TRACE_SEGMENT: "segment", TRACE_UNDERRUN: "underrun", TRACE_IDLE: "idle"}
+
+# Histogram bucket upper bounds (microseconds); a final overflow bucket follows
+INTERVAL_BOUNDS = [250, 350, 500, 700, 1000, 1500, 2000, 3000, 5000, 10000, 50000]
+JITTER_BOUNDS = [1, 2, 5, 10, 20, 50, 100, 200, 500, 1000]
+
+
+def parse(data):
+    """Return (lost event count, [(time_us, type, arg, value)]) with times unwrapped."""
+    if len(data) < HEADER.size:
+        raise ValueError("file too short for a trace header")
+    magic, version, event_size, _, count, lost = HEADER.unpack_from(data)
+    if magic != MAGIC:
+        raise ValueError("not a trace dump (bad magic)")
+    if version != VERSION or event_size != EVENT.size:
+        raise ValueError(f"unsupported trace version {version} / event size {event_size}")
+    if len(data) < HEADER.size + count * EVENT.size:
+        raise ValueError(f"truncated: header says {count} events")
+
+    events = []
+    offset = 0
+    last = None
+    for time_us, kind, arg, value in EVENT.iter_unpack(data[HEADER.size:HEADER.size + count * EVENT.size]):
+        # micros() wraps every ~71 minutes; events are in order, so add
+        # the forward distance to the previous event
+        offset = time_us if last is None else offset + ((time_us - last) & 0xFFFFFFFF)
+        last = time_us
+        events.append((offset, kind, arg, value))
+    return lost, events
+
+
+def histogram(title, values, bounds, unit="us"):
+    counts = [0] * (len(bounds) + 1)
+    for value in values:
+        bucket = 0
+        while bucket < len(bounds) and value > bounds[bucket]:
+            bucket += 1
+        counts[bucket] += 1
+
+    print(f"\n{title} ({len(values)} samples)")
+    if not values:
+        return
+    peak = max(counts)
+    labels = [f"<= {bound} {unit}" for bound in bounds] + [f" > {bounds[-1]} {unit}"]
+    for label, count in zip(labels, counts):
+        bar = "#" * round(40 * count / peak) if peak else ""
+        print(f"  {label:>12} {count:8} {bar}")
+
+
+def analyse(events):
+    """Walk the events; return step intervals, jitter samples and underruns."""
+    intervals = []        # (time_us, interval_us, expected_us)
+    underruns = []        # [time_us, stall_us or None, steps before]
+    axis_steps = [0, 0, 0]
+    period = None         # Programmed period of the tick in progress
+    next_period = None
+    last_step = None
+    pending_underrun = None
+    steps = 0
+
+    for time_us, kind, arg, value in events:
+        if kind == TRACE_SEGMENT:
+            next_period = value
+        elif kind == TRACE_STEP:
+            steps += 1
+            for axis in range(3):
+                if arg & (1 << axis):
+                    axis_steps[axis] += 1
+            if last_step is not None and period is not None:
+                intervals.append((time_us, time_us - last_step, period))
+            if pending_underrun is not None:
+                pending_underrun[1] = time_us - pending_underrun[0]
+                pending_underrun = None
+            last_step = time_us
+            # A segment loaded on this tick sets the period of the next one
+            period = next_period
+        elif kind in (TRACE_UNDERRUN, TRACE_IDLE):
+            # The timer restarts from its start period: not a step interval
+            last_step = None
+            period = next_period = None
+            if kind == TRACE_UNDERRUN:
+                pending_underrun = [time_us, None, steps]
+                underruns.append(pending_underrun)
+
+    return intervals, underruns, axis_steps
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.strip().splitlines()[0])
+    parser.add_argument("input", help="trace dump from /api/trace")
+    parser.add_argument("--late-us", type=int, default=50,
+                        help="report ticks this far from their period (default 50)")
+    parser.add_argument("--worst", type=int, default=10,
+                        help="late ticks to list (default 10)")
+    parser.add_argument("--events", action="store_true",
+                        help="also print every event")
+    args = parser.parse_args()
+
+    with open(args.input, "rb") as f:
+        data = f.read()
+    try:
+        lost, events = parse(data)
+    except ValueError as error:
+        sys.exit(f"error: {error}")
+    if not events:
+        sys.exit("error: trace is empty")
+
+    start = events[0][0]
+    if args.events:
+        for time_us, kind, arg, value in events:
+            print(f"{time_us - start:12} {TYPE_NAMES.get(kind, kind):>8} {arg:3} {value:6}")
+
+    intervals, underruns, axis_steps = analyse(events)
+    counts = {}
+    for _, kind, _, _ in events:
+        name = TYPE_NAMES.get(kind, "unknown")
+        counts[name] = counts.get(name, 0) + 1
+
+    duration = events[-1][0] - start
+    print(f"{len(events)} events over {duration / 1000:.1f} ms ({lost} older events overwritten)")
+    print("  " + ", ".join(f"{name} {count}" for name, count in counts.items()))
+    print(f"  steps per axis: X {axis_steps[0]}, Y {axis_steps[1]}, Z {axis_steps[2]}")
+
+    histogram("Step intervals", [interval for _, interval, _ in intervals], INTERVAL_BOUNDS)
+    histogram("Jitter (|interval - period|)", [abs(interval - expected) for _, interval, expected in intervals],
+              JITTER_BOUNDS)
+
+    late = [tick for tick in intervals if abs(tick[1] - tick[2]) >= args.late_us]
+    late.sort(key=lambda tick: abs(tick[1] - tick[2]), reverse=True)
+    print(f"\n{len(late)} ticks off their period by {args.late_us} us or more")
+    for time_us, interval, expected in late[:args.worst]:
+        print(f"  at {(time_us - start) / 1000:10.3f} ms: {interval} us, period {expected} us "
+              f"({interval - expected:+} us)")
+
+    print(f"\n{len(underruns)} underruns")
+    for time_us, stall, steps in underruns:
+        stalled = f"stalled {stall / 1000:.3f} ms" if stall is not None else "not restarted in the trace"
+        print(f"  at {(time_us - start) / 1000:10.3f} ms after {steps} steps: {stalled}")
+
+
+if __name__ == "__main__":
+    main()